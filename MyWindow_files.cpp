@@ -19,6 +19,7 @@
 // Author(s)     : Baruch Zukerman <baruchzu@post.tau.ac.il>
 
 #include "MyWindow.h"
+#include "read_segments.h"
 
 /*! open a segment file and add new tab */
 void
@@ -79,46 +80,16 @@ MyWindow::load(const QString& filename, bool clear_flag)
       demo_tab()->point_x_set = false;
     }
 
-  //number of segments
-  int count;
-  inputFile >> count;
   Point_2 point_x;
   bool set_point_x = false;
-
-  //file contains a point_x, read in
-  if (count == 0)
-    {
-      NT px0, py0;
-      inputFile >> px0 >> py0;
-      set_point_x = true;
-      point_x = Point_2(px0, py0);
-      inputFile >> count;
-    }
-
-  int i;
   std::list<X_monotone_curve_2> seg_list;
+  bool exact_doubles = false;
 
-  //read the segments and put them in the list
-  for (i = 0; i < count; i++)
-    {
-      NT x0, y0, x1, y1;
-      inputFile >> x0 >> y0 >> x1 >> y1;
-
-      Point_2 p1(x0, y0);
-      Point_2 p2(x1, y1);
-      X_monotone_curve_2 curve(p1, p2);
-
-      CGAL::Bbox_2 curve_bbox = curve.bbox();
-      if (i == 0)
-        {
-        base_tab()->bbox = curve_bbox;
-        }
-      else
-        {
-        base_tab()->bbox = base_tab()->bbox + curve_bbox;
-        }
-      seg_list.push_back(curve);
-    }
+  //read point_x and the segments; dyadic coordinates are built from doubles
+  read_segments<Traits_2>(inputFile, seg_list, point_x, set_point_x,
+      base_tab()->bbox, &exact_doubles);
+  std::cout << "coordinates are " << (exact_doubles ? "doubles" : "exact")
+      << std::endl;
 
   demo_tab()->xcurves = seg_list;
 
@@ -0,0 +1,274 @@
+#ifndef MY_ARR_MIRRORED_TRAITS_2_H
+#define MY_ARR_MIRRORED_TRAITS_2_H
+
+#include <CGAL/enum.h>
+#include <CGAL/Arr_enums.h>
+
+/*! \file
+ * a traits adaptor presenting the input rotated by 180 degrees to the sweep
+ * line without constructing any rotated geometry: the predicates answer as
+ * if x and y were negated, so a sweep over the original arrangements runs
+ * from right to left
+ * by Jannis Warnat
+ */
+
+CGAL_BEGIN_NAMESPACE
+
+/*! \class
+ * Mirrors the segment traits Traits_: left and right as well as above and
+ * below are exchanged. Points and curves are those of Traits_, so the
+ * results of a sweep can be inserted into an arrangement using Traits_.
+ */
+template<class Traits_>
+class Arr_mirrored_traits_2 : public Traits_
+  {
+  public:
+
+    typedef Traits_ Base_traits_2;
+    typedef typename Base_traits_2::Point_2 Point_2;
+    typedef typename Base_traits_2::X_monotone_curve_2 X_monotone_curve_2;
+
+    /*! Default constructor. */
+    Arr_mirrored_traits_2()
+      {
+      }
+
+    /*! Constructor from the traits to mirror. */
+    Arr_mirrored_traits_2(const Base_traits_2& base) :
+      Base_traits_2(base)
+      {
+      }
+
+    /*! Compare the x-coordinates of two points, reversed. */
+    class Compare_x_2
+      {
+        typename Base_traits_2::Compare_x_2 m_base;
+
+      public:
+
+        Compare_x_2(const typename Base_traits_2::Compare_x_2& base) :
+          m_base(base)
+          {
+          }
+
+        Comparison_result operator()(const Point_2& p1, const Point_2& p2) const
+          {
+            return m_base(p2, p1);
+          }
+      };
+
+    Compare_x_2 compare_x_2_object() const
+      {
+        return Compare_x_2(Base_traits_2::compare_x_2_object());
+      }
+
+    /*! Compare two points xy-lexicographically, reversed. */
+    class Compare_xy_2
+      {
+        typename Base_traits_2::Compare_xy_2 m_base;
+
+      public:
+
+        Compare_xy_2(const typename Base_traits_2::Compare_xy_2& base) :
+          m_base(base)
+          {
+          }
+
+        Comparison_result operator()(const Point_2& p1, const Point_2& p2) const
+          {
+            return m_base(p2, p1);
+          }
+      };
+
+    Compare_xy_2 compare_xy_2_object() const
+      {
+        return Compare_xy_2(Base_traits_2::compare_xy_2_object());
+      }
+
+    /*! The left endpoint of the mirrored curve is the right one. */
+    class Construct_min_vertex_2
+      {
+        typename Base_traits_2::Construct_max_vertex_2 m_base;
+
+      public:
+
+        Construct_min_vertex_2(
+            const typename Base_traits_2::Construct_max_vertex_2& base) :
+          m_base(base)
+          {
+          }
+
+        const Point_2& operator()(const X_monotone_curve_2& cv) const
+          {
+            return m_base(cv);
+          }
+      };
+
+    Construct_min_vertex_2 construct_min_vertex_2_object() const
+      {
+        return Construct_min_vertex_2(
+            Base_traits_2::construct_max_vertex_2_object());
+      }
+
+    /*! The right endpoint of the mirrored curve is the left one. */
+    class Construct_max_vertex_2
+      {
+        typename Base_traits_2::Construct_min_vertex_2 m_base;
+
+      public:
+
+        Construct_max_vertex_2(
+            const typename Base_traits_2::Construct_min_vertex_2& base) :
+          m_base(base)
+          {
+          }
+
+        const Point_2& operator()(const X_monotone_curve_2& cv) const
+          {
+            return m_base(cv);
+          }
+      };
+
+    Construct_max_vertex_2 construct_max_vertex_2_object() const
+      {
+        return Construct_max_vertex_2(
+            Base_traits_2::construct_min_vertex_2_object());
+      }
+
+    /*! Above and below are exchanged. */
+    class Compare_y_at_x_2
+      {
+        typename Base_traits_2::Compare_y_at_x_2 m_base;
+
+      public:
+
+        Compare_y_at_x_2(const typename Base_traits_2::Compare_y_at_x_2& base) :
+          m_base(base)
+          {
+          }
+
+        Comparison_result operator()(const Point_2& p,
+            const X_monotone_curve_2& cv) const
+          {
+            return CGAL::opposite(m_base(p, cv));
+          }
+      };
+
+    Compare_y_at_x_2 compare_y_at_x_2_object() const
+      {
+        return Compare_y_at_x_2(Base_traits_2::compare_y_at_x_2_object());
+      }
+
+    /*! To the right of the mirrored curves is to the left of the curves. */
+    class Compare_y_at_x_right_2
+      {
+        typename Base_traits_2::Compare_y_at_x_left_2 m_base;
+
+      public:
+
+        Compare_y_at_x_right_2(
+            const typename Base_traits_2::Compare_y_at_x_left_2& base) :
+          m_base(base)
+          {
+          }
+
+        Comparison_result operator()(const X_monotone_curve_2& cv1,
+            const X_monotone_curve_2& cv2, const Point_2& p) const
+          {
+            return CGAL::opposite(m_base(cv1, cv2, p));
+          }
+      };
+
+    Compare_y_at_x_right_2 compare_y_at_x_right_2_object() const
+      {
+        return Compare_y_at_x_right_2(
+            Base_traits_2::compare_y_at_x_left_2_object());
+      }
+
+    /*! To the left of the mirrored curves is to the right of the curves. */
+    class Compare_y_at_x_left_2
+      {
+        typename Base_traits_2::Compare_y_at_x_right_2 m_base;
+
+      public:
+
+        Compare_y_at_x_left_2(
+            const typename Base_traits_2::Compare_y_at_x_right_2& base) :
+          m_base(base)
+          {
+          }
+
+        Comparison_result operator()(const X_monotone_curve_2& cv1,
+            const X_monotone_curve_2& cv2, const Point_2& p) const
+          {
+            return CGAL::opposite(m_base(cv1, cv2, p));
+          }
+      };
+
+    Compare_y_at_x_left_2 compare_y_at_x_left_2_object() const
+      {
+        return Compare_y_at_x_left_2(
+            Base_traits_2::compare_y_at_x_right_2_object());
+      }
+
+    /*! The left part of the mirrored curve is the right part of the curve. */
+    class Split_2
+      {
+        typename Base_traits_2::Split_2 m_base;
+
+      public:
+
+        Split_2(const typename Base_traits_2::Split_2& base) :
+          m_base(base)
+          {
+          }
+
+        void operator()(const X_monotone_curve_2& cv, const Point_2& p,
+            X_monotone_curve_2& c1, X_monotone_curve_2& c2) const
+          {
+            m_base(cv, p, c2, c1);
+          }
+      };
+
+    Split_2 split_2_object() const
+      {
+        return Split_2(Base_traits_2::split_2_object());
+      }
+  };
+
+/*! \class
+ * The direction of the red and blue halfedges handed to a sweep with the
+ * traits Traits_: against the sweep, so that the face incident to them is
+ * the face above the curve as seen by the sweep.
+ */
+template<class Traits_>
+struct Sweep_halfedge_direction
+  {
+    static const Arr_halfedge_direction value = ARR_RIGHT_TO_LEFT;
+  };
+
+template<class Traits_>
+struct Sweep_halfedge_direction<Arr_mirrored_traits_2<Traits_> >
+  {
+    static const Arr_halfedge_direction value = ARR_LEFT_TO_RIGHT;
+  };
+
+/*! \class
+ * Whether the traits Traits_ mirror the input, so that an order of
+ * y-coordinates computed from the points is reversed for the sweep.
+ */
+template<class Traits_>
+struct Sweep_is_mirrored
+  {
+    static const bool value = false;
+  };
+
+template<class Traits_>
+struct Sweep_is_mirrored<Arr_mirrored_traits_2<Traits_> >
+  {
+    static const bool value = true;
+  };
+
+CGAL_END_NAMESPACE
+
+#endif
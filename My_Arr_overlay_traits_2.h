@@ -28,6 +28,8 @@
 
 #include <CGAL/Object.h>
 #include <CGAL/Arr_tags.h>
+#include "My_Arr_mirrored_traits_2.h"
+#include "My_Intersection_memo.h"
 
 CGAL_BEGIN_NAMESPACE
 
@@ -112,25 +114,37 @@ public:
 
   Kernel kernel; //kernel object
 
+  // crossings of red and blue input segments, see Intersection_memo
+  typedef Intersection_memo<Base_point_2>           Intersection_memo_2;
+
 private:
 
   const Traits_2 * m_base_traits;        // The base traits object.
+  Intersection_memo_2 * m_memo;          // The crossings, or NULL.
 
 public:
 
   /*! Default constructor. */
-  My_Arr_overlay_traits_2()
+  My_Arr_overlay_traits_2() :
+    m_memo (NULL)
   {}
 
   /*! Constructor from a base traits class. */
   My_Arr_overlay_traits_2 (const Traits_2 & base_tr) :
-    m_base_traits (&base_tr)
+    m_base_traits (&base_tr),
+    m_memo (NULL)
   {}
 
   const Traits_2 * base_traits() const { return m_base_traits; }
 
+  /*! Share the crossings of input segments with other sweeps. */
+  void set_intersection_memo (Intersection_memo_2 * memo) { m_memo = memo; }
+
   /*! \class
    * Nested extension of the point type.
+   * adapted by Jannis Warnat: the red, blue and purple vertices are kept as
+   * typed handles (null if there is none) instead of CGAL::Objects, and the
+   * color is fixed when they are set
    */
   class Ex_point_2
     {
@@ -141,38 +155,41 @@ public:
     protected:
 
       Base m_base_pt; // the base point
-      Object m_red_obj; // the red object
-      Object m_blue_obj; // the blue object
-      Object m_purple_obj; // the purple object
-      Vertex_handle invalid_v;
+      Vertex_handle_red m_red_vh; // the red vertex
+      Vertex_handle_blue m_blue_vh; // the blue vertex
+      Vertex_const_handle m_purple_vh; // the purple vertex
+      Color m_color; // the color of the red and blue vertices
 
     public:
 
       /*! Default constructor. */
       Ex_point_2() :
       m_base_pt(),
-      m_red_obj(),
-      m_blue_obj(),
-      m_purple_obj()
+      m_red_vh(),
+      m_blue_vh(),
+      m_purple_vh(),
+      m_color(NOT_SET)
         {
         }
 
       /*! Constructor from a base point. */
       Ex_point_2 (const Base& pt) :
       m_base_pt (pt),
-      m_red_obj(),
-      m_blue_obj(),
-      m_purple_obj()
+      m_red_vh(),
+      m_blue_vh(),
+      m_purple_vh(),
+      m_color(NOT_SET)
         {
         }
 
-      /*! Constructor from a base point with red and blue objects. */
-      Ex_point_2 (const Base& pt, const Object& obj_r, const Object& obj_b) :
+      /*! Constructor from a base point with red and blue vertices. */
+      Ex_point_2 (const Base& pt, Vertex_handle_red v_r, Vertex_handle_blue v_b) :
       m_base_pt (pt),
-      m_red_obj (obj_r),
-      m_blue_obj (obj_b),
-      m_purple_obj()
+      m_red_vh (v_r),
+      m_blue_vh (v_b),
+      m_purple_vh()
         {
+          update_color();
         }
 
       /*! Get the base point (const version). */
@@ -199,169 +216,104 @@ public:
           return (m_base_pt);
         }
 
-      /*! Get the red object. */
-      const Object& red_object() const
+      /*! Get the red vertex. */
+      Vertex_handle_red red_vertex_handle() const
         {
-          return (m_red_obj);
+          return (m_red_vh);
         }
 
-      /*! Get the blue object. */
-      const Object& blue_object() const
+      /*! Get the blue vertex. */
+      Vertex_handle_blue blue_vertex_handle() const
         {
-          return (m_blue_obj);
+          return (m_blue_vh);
         }
 
-      const Object& purple_object() const
+      Vertex_const_handle purple_vertex_handle() const
         {
-          return (m_purple_obj);
+          return (m_purple_vh);
         }
 
-      /*! Check if the red object is empty. */
-      bool is_red_object_empty () const
+      /*! Check if there is no red vertex. */
+      bool is_red_vertex_empty () const
         {
-          return (m_red_obj.is_empty());
+          return (m_red_vh == Vertex_handle_red());
         }
 
-      /*! Check if the blue object is empty. */
-      bool is_blue_object_empty () const
+      /*! Check if there is no blue vertex. */
+      bool is_blue_vertex_empty () const
         {
-          return (m_blue_obj.is_empty());
+          return (m_blue_vh == Vertex_handle_blue());
         }
 
-      bool is_purple_object_empty () const
+      bool is_purple_vertex_empty () const
         {
-          return (m_purple_obj.is_empty());
+          return (m_purple_vh == Vertex_const_handle());
         }
 
-      /*! Set the red object. */
-      void set_red_object (const Object& obj_r)
+      /*! Set the red vertex. */
+      void set_red_vertex_handle (Vertex_handle_red v_r)
         {
-          m_red_obj = obj_r;
+          m_red_vh = v_r;
+          update_color();
         }
 
-      /*! Set the blue object. */
-      void set_blue_object (const Object& obj_b)
+      /*! Set the blue vertex. */
+      void set_blue_vertex_handle (Vertex_handle_blue v_b)
         {
-          m_blue_obj = obj_b;
+          m_blue_vh = v_b;
+          update_color();
         }
 
-      void set_purple_object (const Object& obj_p)
+      void set_purple_vertex_handle (Vertex_const_handle v_p)
         {
-          m_purple_obj = obj_p;
+          m_purple_vh = v_p;
         }
 
-      /*! Get the color of the point. */
+      /*! Get the color of the point, NOT_SET for red-blue intersections. */
       Color color () const
         {
-          Vertex_const_handle vh;
-          Vertex_const_handle invalid_vh;
+          return m_color;
+        }
 
-          if (!is_red_object_empty())
+      // get the type the vertex will be in the purple arrangement
+      Vertex_type purple_data () const
+        {
+          if (!is_red_vertex_empty())
             {
-              try
-                {
-                  vh = object_cast<Vertex_const_handle> (red_object());
-                }
-              catch (Bad_object_cast)
-                {
-                  CGAL_assertion(false);
-                }
-
-              if(vh->data().type() == DEFAULT)
-                {
-                  return RED;
-                }
-
-              if(vh->data().type() == POINT_X)
+              Vertex_type type = m_red_vh->data().type();
+              if (type == EXTERNAL_ENDPOINT)
                 {
-                  return RED;
-                }
-
-              if(vh->data().type() == INTERNAL_ENDPOINT)
-                {
-                  return RED;
-                }
-              else
-                {
-                  return BLUE;
+                  return INTERNAL_ENDPOINT;
                 }
+              return type;
             }
-          else
+
+          CGAL_assertion(!is_blue_vertex_empty());
+          if (m_blue_vh->data().type() == DEFAULT)
             {
-              CGAL_assertion(!is_blue_object_empty());
-              try
-                {
-                  vh = object_cast<Vertex_const_handle> (blue_object());
-                }
-              catch (Bad_object_cast)
-                {
-                  CGAL_assertion(false);
-                }
-              return BLUE;
+              return DEFAULT;
             }
+          return INTERNAL_ENDPOINT;
         }
 
-      // get the type the vertex will be in the purple arrangement
-      Vertex_type purple_data ()
-        {
-          Vertex_const_handle vh;
-          Vertex_const_handle invalid_vh;
+    protected:
 
-          if (!is_red_object_empty())
+      // a red vertex that is the external endpoint of the red arrangement
+      // stands for a blue point
+      void update_color ()
+        {
+          if (!is_red_vertex_empty())
             {
-              try
-                {
-                  vh = object_cast<Vertex_const_handle> (red_object());
-                }
-              catch (Bad_object_cast)
-                {
-                  CGAL_assertion(false);
-                }
-
-              if(vh->data().type() == DEFAULT)
-                {
-                  return DEFAULT;
-                }
-
-              if(vh->data().type() == POINT_X)
-                {
-                  return POINT_X;
-                }
-
-              if(vh->data().type() == INTERNAL_ENDPOINT)
-                {
-                  return INTERNAL_ENDPOINT;
-                }
-              else
-                {
-                  CGAL_assertion(vh->data().type() == EXTERNAL_ENDPOINT);
-                  return INTERNAL_ENDPOINT;
-                }
+              m_color = (m_red_vh->data().type() == EXTERNAL_ENDPOINT) ? BLUE
+                  : RED;
+            }
+          else if (!is_blue_vertex_empty())
+            {
+              m_color = BLUE;
             }
           else
             {
-              try
-                {
-                  vh = object_cast<Vertex_const_handle> (blue_object());
-                }
-              catch (Bad_object_cast)
-                {
-                  CGAL_assertion(false);
-                }
-
-              if(vh->data().type() == DEFAULT)
-                {
-                  return DEFAULT;
-                }
-
-              if(vh->data().type() == INTERNAL_ENDPOINT)
-                {
-                  return INTERNAL_ENDPOINT;
-                }
-              else
-                {
-                  return INTERNAL_ENDPOINT;
-                }
+              m_color = NOT_SET;
             }
         }
     };
@@ -419,9 +371,11 @@ public:
       m_blue_halfedge_handle (he_b)
         {
           CGAL_precondition (he_r == Halfedge_handle_red() ||
-              he_r->direction() == ARR_RIGHT_TO_LEFT);
+              he_r->direction() ==
+              Sweep_halfedge_direction<Traits_2>::value);
           CGAL_precondition (he_b == Halfedge_handle_blue() ||
-              he_b->direction() == ARR_RIGHT_TO_LEFT);
+              he_b->direction() ==
+              Sweep_halfedge_direction<Traits_2>::value);
           left_set = false;
           right_set = false;
         }
@@ -498,7 +452,8 @@ public:
       void set_red_halfedge_handle (Halfedge_handle_red he_r)
         {
           CGAL_precondition (he_r == Halfedge_handle_red() ||
-              he_r->direction() == ARR_RIGHT_TO_LEFT);
+              he_r->direction() ==
+              Sweep_halfedge_direction<Traits_2>::value);
 
           m_red_halfedge_handle = he_r;
         }
@@ -507,7 +462,8 @@ public:
       void set_blue_halfedge_handle (Halfedge_handle_blue he_b)
         {
           CGAL_precondition (he_b == Halfedge_handle_blue() ||
-              he_b->direction() == ARR_RIGHT_TO_LEFT);
+              he_b->direction() ==
+              Sweep_halfedge_direction<Traits_2>::value);
 
           m_blue_halfedge_handle = he_b;
         }
@@ -545,6 +501,80 @@ public:
 
   typedef Ex_x_monotone_curve_2 X_monotone_curve_2;
 
+  /*!
+   * Get the memorized crossing of the input segments of a red and a blue
+   * curve (Jannis Warnat).
+   * \return The crossing point, or NULL if there is none or no memo.
+   */
+  const Base_point_2 * memorized_crossing (const X_monotone_curve_2 & xcv1,
+                                           const X_monotone_curve_2 & xcv2)
+    const
+  {
+    unsigned int red, blue;
+    if (!_segment_pair (xcv1, xcv2, red, blue))
+      return (NULL);
+    return (m_memo->find (red, blue));
+  }
+
+  /*!
+   * Memorize p, an intersection point of a red and a blue curve, as the
+   * crossing of their input segments, unless the curves are collinear
+   * (Jannis Warnat).
+   */
+  void memorize_crossing (const X_monotone_curve_2 & xcv1,
+                          const X_monotone_curve_2 & xcv2,
+                          const Base_point_2 & p) const
+  {
+    unsigned int red, blue;
+    if (!_segment_pair (xcv1, xcv2, red, blue))
+      return;
+
+    const Base_x_monotone_curve_2 & b1 = xcv1.base();
+    const Base_x_monotone_curve_2 & b2 = xcv2.base();
+    if (kernel.orientation_2_object() (b1.source(), b1.target(),
+                                       b2.source()) == COLLINEAR &&
+        kernel.orientation_2_object() (b1.source(), b1.target(),
+                                       b2.target()) == COLLINEAR)
+      return;
+
+    m_memo->insert (red, blue, p);
+  }
+
+private:
+
+  // the input segments of a red and a blue curve, if there is a memo
+  bool _segment_pair (const X_monotone_curve_2 & xcv1,
+                      const X_monotone_curve_2 & xcv2,
+                      unsigned int & red, unsigned int & blue) const
+  {
+    if (m_memo == NULL)
+      return (false);
+
+    Halfedge_handle_red red_he;
+    Halfedge_handle_blue blue_he;
+    if (xcv1.color() == RED && xcv2.color() == BLUE)
+    {
+      red_he = xcv1.red_halfedge_handle();
+      blue_he = xcv2.blue_halfedge_handle();
+    }
+    else if (xcv1.color() == BLUE && xcv2.color() == RED)
+    {
+      red_he = xcv2.red_halfedge_handle();
+      blue_he = xcv1.blue_halfedge_handle();
+    }
+    else
+      return (false);
+
+    if (!red_he->data().has_segment() || !blue_he->data().has_segment())
+      return (false);
+
+    red = red_he->data().segment();
+    blue = blue_he->data().segment();
+    return (true);
+  }
+
+public:
+
   friend std::ostream& operator<< (std::ostream& os,
       const X_monotone_curve_2& xcv)
     {
@@ -878,6 +908,25 @@ public:
 
       const Traits_2 * m_base_tr = m_traits->base_traits();
 
+      // Pieces of two input segments whose crossing is known intersect at
+      // most there; the crossing lies on both supporting lines, so it is
+      // on a piece iff it is between its endpoints (Jannis Warnat).
+      const Base_point_2 * crossing =
+        m_traits->memorized_crossing (xcv1, xcv2);
+      if (crossing != NULL)
+      {
+        Base_compare_xy_2 cmp_xy = m_base_tr->compare_xy_2_object();
+        if (cmp_xy (*crossing, xcv1.base().source()) !=
+              cmp_xy (*crossing, xcv1.base().target()) &&
+            cmp_xy (*crossing, xcv2.base().source()) !=
+              cmp_xy (*crossing, xcv2.base().target()))
+        {
+          *oi = CGAL::make_object (std::make_pair (Point_2 (*crossing), 1u));
+          ++oi;
+        }
+        return (oi);
+      }
+
       if (bx1 == ARR_INTERIOR && by1 == ARR_INTERIOR &&
           bx2 == ARR_INTERIOR && by2 == ARR_INTERIOR)
       {
@@ -899,28 +948,10 @@ public:
 
         if (base_ipt != NULL)
         {
-          // We have an red-blue intersection point, so we attach the
-          // intersecting red and blue halfedges to it.
-          Object   red_obj;
-          Object   blue_obj;
-
-          if (xcv1.color() == RED)
-          {
-            CGAL_assertion (xcv2.color() == BLUE);
-            red_obj = CGAL::make_object (xcv1.red_halfedge_handle());
-            blue_obj = CGAL::make_object (xcv2.blue_halfedge_handle());
-          }
-          else
-          {
-            CGAL_assertion(xcv2.color() == RED &&
-                           xcv1.color() == BLUE);
-            red_obj = CGAL::make_object(xcv2.red_halfedge_handle());
-            blue_obj = CGAL::make_object(xcv1.blue_halfedge_handle());
-          }
-
-          // Create the extended point and add the multiplicity.
-          Point_2   ex_point (base_ipt->first,
-                              red_obj, blue_obj);
+          // We have an red-blue intersection point; it has no red or blue
+          // vertex, its purple vertex is set by the sweep.
+          m_traits->memorize_crossing (xcv1, xcv2, base_ipt->first);
+          Point_2   ex_point (base_ipt->first);
           *oi = CGAL::make_object(std::make_pair (ex_point, 
                                                   base_ipt->second));
         }
@@ -1034,17 +1065,18 @@ public:
     {
       // Create the objects that wrap the arrangement vertex.
       // Note that the halfedges associated with the curves are always
-      // directed from right to left, so their target is the smaller end.
+      // directed against the sweep, so their target is the smaller end.
       const Base_point_2&   base_p = m_base_min_v (xcv.base());
-      Object                obj_red, obj_blue;
+      Vertex_handle_red     v_red;
+      Vertex_handle_blue    v_blue;
 
       if (xcv.color() == RED)
       {
-        obj_red = CGAL::make_object (xcv.red_halfedge_handle()->target());
+        v_red = xcv.red_halfedge_handle()->target();
       }
       else if (xcv.color() == BLUE)
       {
-        obj_blue = CGAL::make_object (xcv.blue_halfedge_handle()->target());
+        v_blue = xcv.blue_halfedge_handle()->target();
       }
       else
       {
@@ -1054,18 +1086,18 @@ public:
             m_base_equal (base_p,
                           xcv.red_halfedge_handle()->target()->point()))
         {
-          obj_red = CGAL::make_object (xcv.red_halfedge_handle()->target());
+          v_red = xcv.red_halfedge_handle()->target();
         }
 
         if (! xcv.blue_halfedge_handle()->target()->is_at_open_boundary() &&
             m_base_equal (base_p,
                           xcv.blue_halfedge_handle()->target()->point()))
         {
-          obj_blue = CGAL::make_object (xcv.blue_halfedge_handle()->target());
+          v_blue = xcv.blue_halfedge_handle()->target();
         }
       }
 
-      return (Point_2 (base_p, obj_red, obj_blue));
+      return (Point_2 (base_p, v_red, v_blue));
     }
   };
 
@@ -1105,17 +1137,18 @@ public:
     {
       // Create the objects that wrap the arrangement vertex.
       // Note that the halfedges associated with the curves are always
-      // directed from right to left, so their target is the smaller end.
+      // directed against the sweep, so their target is the smaller end.
       const Base_point_2&   base_p = m_base_max_v (xcv.base());
-      Object                obj_red, obj_blue;
+      Vertex_handle_red     v_red;
+      Vertex_handle_blue    v_blue;
 
       if(xcv.color() == RED)
       {
-        obj_red = CGAL::make_object (xcv.red_halfedge_handle()->source());
+        v_red = xcv.red_halfedge_handle()->source();
       }
       else if(xcv.color() == BLUE)
       {
-        obj_blue = CGAL::make_object (xcv.blue_halfedge_handle()->source());
+        v_blue = xcv.blue_halfedge_handle()->source();
       }
       else
       {
@@ -1125,18 +1158,18 @@ public:
             m_base_equal (base_p,
                           xcv.red_halfedge_handle()->source()->point()))
         {
-          obj_red = CGAL::make_object (xcv.red_halfedge_handle()->source());
+          v_red = xcv.red_halfedge_handle()->source();
         }
 
         if (! xcv.blue_halfedge_handle()->source()->is_at_open_boundary() &&
             m_base_equal (base_p,
                           xcv.blue_halfedge_handle()->source()->point()))
         {
-          obj_blue = CGAL::make_object (xcv.blue_halfedge_handle()->source());
+          v_blue = xcv.blue_halfedge_handle()->source();
         }
       }
 
-      return (Point_2 (base_p, obj_red, obj_blue));
+      return (Point_2 (base_p, v_red, v_blue));
     }
   };
 
@@ -1273,16 +1306,16 @@ public:
     Comparison_result operator() (const Point_2& p1, const Point_2& p2) const
     {
       // Check if there wither points represent red or blue vertices.
-      Vertex_handle_red  vr1;
-      Vertex_handle_red  vr2;
+      const Vertex_handle_red  vr1 = p1.red_vertex_handle();
+      const Vertex_handle_red  vr2 = p2.red_vertex_handle();
 
-      Vertex_handle_blue vb1;
-      Vertex_handle_blue vb2;
+      const Vertex_handle_blue vb1 = p1.blue_vertex_handle();
+      const Vertex_handle_blue vb2 = p2.blue_vertex_handle();
 
-      const bool         assign_v1_red  = CGAL::assign (vr1, p1.red_object());
-      const bool         assign_v2_red  = CGAL::assign (vr2, p2.red_object());
-      const bool         assign_v1_blue = CGAL::assign (vb1, p1.blue_object());
-      const bool         assign_v2_blue = CGAL::assign (vb2, p2.blue_object());
+      const bool         assign_v1_red  = ! p1.is_red_vertex_empty();
+      const bool         assign_v2_red  = ! p2.is_red_vertex_empty();
+      const bool         assign_v1_blue = ! p1.is_blue_vertex_empty();
+      const bool         assign_v2_blue = ! p2.is_blue_vertex_empty();
 
       if ((assign_v1_red && assign_v1_blue) ||
           (assign_v2_red && assign_v2_blue))
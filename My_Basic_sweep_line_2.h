@@ -25,10 +25,15 @@
  * Definition of the Basic_sweep_line_2 class.
  */
 
+#include <CGAL/Arr_walk_along_line_point_location.h>
+
+#include "My_Arr_mirrored_traits_2.h"
 #include "My_Sweep_line_functors.h"
+#include "My_Scout_set.h"
+#include "My_Sweep_arena.h"
 #include "My_Sweep_line_subcurve.h"
-#include "Scout.h"
 #include "My_Sweep_line_event.h"
+#include "Scout.h"
 
 CGAL_BEGIN_NAMESPACE
 
@@ -47,6 +52,7 @@ template<class Arrangement_, class Traits_, class Subcurve_, typename Event_,
   public:
 
     typedef Traits_ Traits_2;
+    typedef typename Traits_2::Traits_2 Base_traits_2;
     typedef Event_ Event;
     typedef Subcurve_ Subcurve;
     typedef Allocator_ Allocator;
@@ -69,6 +75,22 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
     typedef typename Arrangement_2::Vertex_handle Vertex_handle;
     typedef typename Arrangement_2::Vertex_const_handle Vertex_const_handle;
     typedef typename Arrangement_2::Halfedge_handle Halfedge_handle;
+    typedef typename Arrangement_2::Halfedge_const_handle Halfedge_const_handle;
+    typedef typename Arrangement_2::Halfedge Halfedge;
+    typedef typename Arrangement_2::Face_handle Face_handle;
+    typedef typename Arrangement_2::Face_const_handle Face_const_handle;
+    typedef Arr_walk_along_line_point_location<Arrangement_2>
+        Purple_point_location;
+
+    // the purple vertices of red blue intersections, by the red and the blue
+    // edge meeting there; lets a second sweep reuse the vertices of the first
+    typedef std::pair<const Halfedge*, const Halfedge*> Edge_pair;
+    typedef std::map<Edge_pair, Vertex_handle> Intersection_vertex_map;
+
+    // the purple vertices created on demand, by the red vertex at their
+    // point or, if there is none, the blue one
+    typedef typename Arrangement_2::Vertex Vertex;
+    typedef std::map<const Vertex*, Vertex_handle> Purple_vertex_map;
 
     typedef typename Event::Subcurve_iterator
     Event_subcurve_iterator;
@@ -82,14 +104,11 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
     typedef Multiset<Base_subcurve*,
     Compare_curves,
     Allocator> Status_line;
-    typedef Multiset<My_Scout*,Compare_scouts,Allocator> Scout_set;
+    typedef Summarized_multiset<My_Scout*,Compare_scouts,Scout_summary<My_Scout> > Scout_set;
     typedef typename Status_line::iterator Status_line_iterator;
     typedef typename Scout_set::iterator Scout_set_iterator;
     typedef typename Scout_set::reverse_iterator Scout_set_reverse_iterator;
 
-    typedef typename Allocator::template rebind<Event> Event_alloc_rebind;
-    typedef typename Event_alloc_rebind::other Event_alloc;
-
     typedef typename Allocator::template rebind<Subcurve> Subcurve_alloc_rebind;
     typedef typename Subcurve_alloc_rebind::other Subcurve_alloc;
 
@@ -102,29 +121,22 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
 
   protected:
 
-    /*! \struct
-     * An auxiliary functor for comparing event pointers.
-     */
-    struct CompEventPtr
-      {
-        Comparison_result operator() (Event *e1, Event *e2) const
-          {
-            if (e1 < e2)
-            return (SMALLER);
-            if (e1> e2)
-            return (LARGER);
-            return (EQUAL);
-          }
-      };
-
-    typedef Multiset<Event*, CompEventPtr> Allocated_events_set;
-    typedef typename Allocated_events_set::iterator Allocated_events_iterator;
-
     // Data members:
 
     //the output arrangement
     Arrangement_2* m_purple;
 
+    //the purple vertices of red blue intersections, may be shared with
+    //another sweep into the same purple arrangement
+    Intersection_vertex_map* m_purple_intersections;
+
+    //the purple vertices of red and blue vertices, if these are created
+    //on demand; may be shared like the intersections
+    Purple_vertex_map* m_purple_vertices;
+
+    //the point locations in the purple arrangement, see _insert_purple_point()
+    std::size_t m_purple_locates;
+
     Traits_adaptor_2 *m_traits; // A traits-class object.
     bool m_traitsOwner; // Whether this object was allocated by
     // this class (and thus should be freed).
@@ -134,7 +146,6 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
     Event_queue_iterator m_currentEventIter;
     Vertex_const_handle current_vertex;
     Point_2 current_event_point;
-    typename Traits_2::Color current_event_point_color;
 
     // Comparison functor for the status line.
     Compare_curves m_statusLineCurveLess;
@@ -154,9 +165,14 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
     Status_line m_red_statusLine; // The status line (the Y-structure).
     Status_line m_blue_statusLine;
 
-    Allocated_events_set m_allocated_events;
-    // The events that have been allocated
-    // (and have not yet been deallocated).
+    Sweep_arena<Event> m_event_arena;
+    // The events, released together by _complete_sweep().
+
+    Sweep_arena<Subcurve> m_overlap_subcurve_arena;
+    // The subcurves created for overlaps.
+
+    Sweep_arena<My_Scout> m_scout_arena;
+    // The scouts, including the ended ones and the dummies.
 
     Status_line_iterator m_red_status_line_insert_hint;
     Status_line_iterator m_blue_status_line_insert_hint;
@@ -175,7 +191,6 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
     Subcurve* c_blue_below; //the current blue curve below
     Subcurve* c_red_below; //the current red curve below
 
-    Event_alloc m_eventAlloc; // An allocator for the events objects.
     Subcurve_alloc m_subCurveAlloc; // An allocator for the subcurve objects.
 
     Event m_masterEvent; // A master Event (created once by the
@@ -211,8 +226,29 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
         PointInputIterator points_end)
       {
         _init_points(points_begin, points_end, Base_event::ACTION);
-        _init_red_sweep(red_curves_begin, red_curves_end);
-        _init_blue_sweep(blue_curves_begin, blue_curves_end);
+        _init_sweep(red_curves_begin, red_curves_end, Red_tag());
+        _init_sweep(blue_curves_begin, blue_curves_end, Blue_tag());
+        _init_curve_pairs();
+        _sweep();
+        _complete_sweep();
+      }
+
+    /*!
+     * Run the sweep like sweep(), for points that are pairwise different
+     * and given in the order of the event queue; their events are appended
+     * to the queue without comparisons.
+     */
+    template<class CurveInputIterator, class PointInputIterator>
+    void sweep_sorted (CurveInputIterator red_curves_begin,
+        CurveInputIterator red_curves_end,
+        CurveInputIterator blue_curves_begin,
+        CurveInputIterator blue_curves_end,
+        PointInputIterator points_begin,
+        PointInputIterator points_end)
+      {
+        _init_sorted_points(points_begin, points_end, Base_event::ACTION);
+        _init_sweep(red_curves_begin, red_curves_end, Red_tag());
+        _init_sweep(blue_curves_begin, blue_curves_end, Blue_tag());
         _init_curve_pairs();
         _sweep();
         _complete_sweep();
@@ -236,127 +272,62 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
         return d_to_n_default;
       }
 
-    //check the color and choose the correct data
-    unsigned int number_of_right_curves()
+    //the data of the color of the tag at the current event
+    template<class Color>
+    unsigned int number_of_right_curves(Color)
       {
-        if(current_event_point_color == Traits_2::BLUE)
-          {
-            return m_currentEvent->number_of_blue_right_curves();
-          }
-        else
-          {
-            return m_currentEvent->number_of_red_right_curves();
-          }
+        return m_currentEvent->number_of_right_curves(Color());
       }
 
-    //check the color and choose the correct data
-    unsigned int number_of_left_curves()
+    //the data of the color of the tag at the current event
+    template<class Color>
+    unsigned int number_of_left_curves(Color)
       {
-        if(current_event_point_color == Traits_2::BLUE)
-          {
-            return m_currentEvent->number_of_blue_left_curves();
-          }
-        else
-          {
-            return m_currentEvent->number_of_red_left_curves();
-          }
+        return m_currentEvent->number_of_left_curves(Color());
       }
 
-    //check the color and choose the correct data
-    Event_subcurve_iterator left_curves_begin()
+    //the data of the color of the tag at the current event
+    template<class Color>
+    Event_subcurve_iterator left_curves_begin(Color)
       {
-        if(current_event_point_color == Traits_2::BLUE)
-          {
-            return m_currentEvent->blue_left_curves_begin();
-          }
-        else
-          {
-            return m_currentEvent->red_left_curves_begin();
-          }
+        return m_currentEvent->left_curves_begin(Color());
       }
 
-    //check the color and choose the correct data
-    Event_subcurve_iterator left_curves_end()
+    //the data of the color of the tag at the current event
+    template<class Color>
+    Event_subcurve_iterator left_curves_end(Color)
       {
-        if(current_event_point_color == Traits_2::BLUE)
-          {
-            return m_currentEvent->blue_left_curves_end();
-          }
-        else
-          {
-            return m_currentEvent->red_left_curves_end();
-          }
+        return m_currentEvent->left_curves_end(Color());
       }
 
-    //check the color and choose the correct data
-    Event_subcurve_iterator right_curves_begin()
+    //the data of the color of the tag at the current event
+    template<class Color>
+    Event_subcurve_iterator right_curves_begin(Color)
       {
-        if(current_event_point_color == Traits_2::BLUE)
-          {
-            return m_currentEvent->blue_right_curves_begin();
-          }
-        else
-          {
-            return m_currentEvent->red_right_curves_begin();
-          }
+        return m_currentEvent->right_curves_begin(Color());
       }
 
-    //check the color and choose the correct data
-    Event_subcurve_iterator right_curves_end()
+    //the data of the color of the tag at the current event
+    template<class Color>
+    Event_subcurve_iterator right_curves_end(Color)
       {
-        if(current_event_point_color == Traits_2::BLUE)
-          {
-            return m_currentEvent->blue_right_curves_end();
-          }
-        else
-          {
-            return m_currentEvent->red_right_curves_end();
-          }
+        return m_currentEvent->right_curves_end(Color());
       }
 
-    //check the color and choose the correct data
-    Status_line* different_colored_status_line()
+    //the data of the color of the tag at the current event
+    template<class Color>
+    Status_line* different_colored_status_line(Color)
       {
-        if (current_event_point_color == Traits_2::BLUE)
-          {
-            return &m_red_statusLine;
-
-          }
-        else
-          {
-            return &m_blue_statusLine;
-          }
+        return &_status_line(typename Color::Other());
       }
 
-    //check the color and choose the correct data
-    Status_line* same_colored_status_line()
+    //the data of the color of the tag at the current event
+    template<class Color>
+    Status_line* same_colored_status_line(Color)
       {
-        if (current_event_point_color == Traits_2::BLUE)
-          {
-            return &m_blue_statusLine;
-
-          }
-        else
-          {
-            return &m_red_statusLine;
-          }
-      }
-
-    //check the color and choose the correct data
-    Status_line_iterator status_line_insert_hint()
-      {
-        if (current_event_point_color == Traits_2::BLUE)
-          {
-            return m_blue_status_line_insert_hint;
-
-          }
-        else
-          {
-            return m_red_status_line_insert_hint;
-          }
+        return &_status_line(Color());
       }
 
-
     //the color of the curve directly below
     void set_current_color_below(typename Traits_2::Color c)
       {
@@ -419,6 +390,27 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
         return c_blue_below;
       }
 
+    //the current curve below of the color of the tag
+    void set_current_below(Subcurve* s, Red_tag)
+      {
+        set_current_red_below(s);
+      }
+
+    void set_current_below(Subcurve* s, Blue_tag)
+      {
+        set_current_blue_below(s);
+      }
+
+    Subcurve* current_below(Red_tag)
+      {
+        return c_red_below;
+      }
+
+    Subcurve* current_below(Blue_tag)
+      {
+        return c_blue_below;
+      }
+
     /*! Get an iterator for the first subcurve in the status line. */
     Status_line_iterator red_status_line_begin ()
       {
@@ -508,13 +500,6 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
         return (m_queue->empty());
       }
 
-    /*!
-     * Deallocate event object.
-     * This method is made public to allow the visitor to manage the events
-     * deallocation (as necessary).
-     */
-    void deallocate_event(Event* event);
-
     /*! Get the current event */
     Event* current_event()
       {
@@ -533,6 +518,142 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
         return m_purple;
       }
 
+    // sweep into an existing purple arrangement instead of a new one; the
+    // vertices of red blue intersections are looked up in and added to
+    // intersections, so two sweeps over the same red and blue arrangements
+    // create each of them once. Without vertices, the meta points of the red
+    // and blue vertices carry their purple vertex; with vertices, these are
+    // created when the first edge is inserted at them
+    void set_purple(Arrangement_2* purple,
+        Intersection_vertex_map* intersections,
+        Purple_vertex_map* vertices = 0)
+      {
+        delete m_purple;
+        m_purple = purple;
+        m_purple_intersections = intersections;
+        m_purple_vertices = vertices;
+      }
+
+    // the number of point locations in the purple arrangement
+    std::size_t purple_locates() const
+      {
+        return m_purple_locates;
+      }
+
+    // the purple vertex of the intersection of a red and a blue edge, given
+    // by halfedges of either direction; inserted at p if not there yet
+    Vertex_handle purple_intersection_vertex(Halfedge_const_handle red,
+        Halfedge_const_handle blue, const Base_point_2& p)
+      {
+        typename Intersection_vertex_map::iterator it;
+        Edge_pair edges(_edge_key(red), _edge_key(blue));
+        if (m_purple_intersections != 0)
+          {
+            it = m_purple_intersections->find(edges);
+            if (it != m_purple_intersections->end())
+              {
+                return it->second;
+              }
+          }
+
+        bool created;
+        Vertex_handle vh = _insert_purple_point(p, created);
+        if (created)
+          {
+            vh->set_data(DEFAULT);
+          }
+
+        if (m_purple_intersections != 0)
+          {
+            m_purple_intersections->insert(std::make_pair(edges, vh));
+          }
+        return vh;
+      }
+
+    // does the purple arrangement already contain an edge between u and v,
+    // e.g. inserted by an earlier sweep?
+    bool has_purple_edge(Vertex_handle u, Vertex_handle v)
+      {
+        if (u->is_isolated() || u->degree() == 0)
+          {
+            return false;
+          }
+
+        typename Arrangement_2::Halfedge_around_vertex_circulator first =
+            u->incident_halfedges();
+        typename Arrangement_2::Halfedge_around_vertex_circulator curr = first;
+        do
+          {
+            if (curr->source() == v)
+              {
+                return true;
+              }
+            ++curr;
+          }
+        while (curr != first);
+        return false;
+      }
+
+    // insert the edge of cv from its left end left to its right end right,
+    // the current event, into the purple arrangement; cv is a piece of the
+    // input segment of its red or blue edge. A missing purple vertex at an
+    // end is created with the edge: from the vertex at the other end, CGAL
+    // finds the face of the edge around that vertex. Returns the halfedge
+    // from left to right, or an invalid handle if an earlier sweep inserted
+    // the edge already
+    Halfedge_handle insert_purple_curve(const X_monotone_curve_2& cv,
+        const Point_2& left, const Point_2& right)
+      {
+        Vertex_handle u, v;
+        bool has_u = _find_purple_vertex(left, u);
+        bool has_v = _find_purple_vertex(right, v);
+
+        //no edge is incident to the curve yet, so its face is not known
+        //from a vertex; the vertex at the event is inserted alone first
+        if (!has_u && !has_v)
+          {
+            bool created;
+            v = _insert_purple_point(right.base(), created);
+            _set_purple_vertex(right, v);
+            has_v = true;
+          }
+
+        Halfedge_handle he;
+        if (has_u && has_v)
+          {
+            if (has_purple_edge(u, v))
+              {
+                return Halfedge_handle();
+              }
+            he = m_purple->insert_at_vertices(cv.base(), u, v);
+          }
+        else
+          {
+            //left is the xy-smaller end of cv, unless the sweep is mirrored
+            Vertex_handle from = has_u ? u : v;
+            if (has_u != Sweep_is_mirrored<Base_traits_2>::value)
+              {
+                he = m_purple->insert_from_left_vertex(cv.base(), from);
+              }
+            else
+              {
+                he = m_purple->insert_from_right_vertex(cv.base(), from);
+              }
+            _set_purple_vertex(has_u ? right : left, he->target());
+          }
+
+        if (he->direction() == Sweep_halfedge_direction<Base_traits_2>::value)
+          {
+            he = he->twin();
+          }
+
+        Halfedge_const_handle origin = (cv.color() == Traits_2::BLUE) ?
+            cv.blue_halfedge_handle() : cv.red_halfedge_handle();
+        he->set_data(origin->data());
+        he->twin()->set_data(origin->data());
+        return he;
+      }
+
     // get the set of scouts
     Scout_set* get_scouts()
       {
@@ -565,28 +686,35 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
         return;
       }
 
-    /*! Create a Subcurve object and two Event objects for each curve. */
-    template<class CurveInputIterator>
-    void _init_red_curves (CurveInputIterator curves_begin,
-        CurveInputIterator curves_end)
+    /*!
+     * Create an event object for each input point, given in the order of the
+     * event queue and without duplicates, in linear time: the events are
+     * appended to the empty queue.
+     */
+    template <class PointInputIterator>
+    void _init_sorted_points (PointInputIterator points_begin,
+        PointInputIterator points_end,
+        Attribute type)
       {
-        CurveInputIterator cit;
-        unsigned int index = 0;
+        CGAL_precondition(m_queue->empty());
+        m_queueEventLess.set_parameter_space_in_x(ARR_INTERIOR);
+        m_queueEventLess.set_parameter_space_in_y(ARR_INTERIOR);
 
-        for (cit = curves_begin; cit != curves_end; ++cit, ++index)
+        PointInputIterator pit;
+        for (pit = points_begin; pit != points_end; ++pit)
           {
-            CGAL_assertion(cit->left_is_set());
-            CGAL_assertion(cit->right_is_set());
-            _init_red_curve (*cit, index);
+            Event* e = _allocate_event(*pit, type, ARR_INTERIOR, ARR_INTERIOR);
+            CGAL_expensive_assertion(m_queue->empty() ||
+                m_queueEventLess(*pit, *(--m_queue->end())) == LARGER);
+            m_queue->insert_before(m_queue->end(), e);
           }
-
         return;
       }
 
     /*! Create a Subcurve object and two Event objects for each curve. */
-    template<class CurveInputIterator>
-    void _init_blue_curves (CurveInputIterator curves_begin,
-        CurveInputIterator curves_end)
+    template<class CurveInputIterator, class Color>
+    void _init_curves (CurveInputIterator curves_begin,
+        CurveInputIterator curves_end, Color)
       {
         CurveInputIterator cit;
         unsigned int index = 0;
@@ -595,49 +723,177 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
           {
             CGAL_assertion(cit->left_is_set());
             CGAL_assertion(cit->right_is_set());
-
-            _init_blue_curve (*cit, index);
+            _init_curve (*cit, index, Color());
           }
 
         return;
       }
 
     /*! Initiliaze the sweep algorithm. */
-    template<class CurveInputIterator>
-    void _init_red_sweep (CurveInputIterator curves_begin,
-        CurveInputIterator curves_end)
+    template<class CurveInputIterator, class Color>
+    void _init_sweep (CurveInputIterator curves_begin,
+        CurveInputIterator curves_end, Color)
       {
-        m_num_of_red_subCurves = std::distance (curves_begin, curves_end);
+        _num_of_subcurves(Color()) = std::distance (curves_begin, curves_end);
 
-        _init_red_structures();
+        _init_structures(Color());
 
         // Initialize the curves.
-        _init_red_curves (curves_begin, curves_end);
+        _init_curves (curves_begin, curves_end, Color());
         return;
       }
 
-    /*! Initiliaze the sweep algorithm. */
-    template<class CurveInputIterator>
-    void _init_blue_sweep (CurveInputIterator curves_begin,
-        CurveInputIterator curves_end)
+    /*! Initialize the data structures for the sweep-line algorithm. */
+    template<class Color>
+    void _init_structures (Color);
+
+    // the data of one color, selected at compile time by its tag
+    Status_line& _status_line(Red_tag)
       {
-        m_num_of_blue_subCurves = std::distance (curves_begin, curves_end);
+        return m_red_statusLine;
+      }
 
-        _init_blue_structures();
+    Status_line& _status_line(Blue_tag)
+      {
+        return m_blue_statusLine;
+      }
 
-        // Initialize the curves.
-        _init_blue_curves (curves_begin, curves_end);
-        return;
+    Status_line_iterator& _status_line_insert_hint(Red_tag)
+      {
+        return m_red_status_line_insert_hint;
       }
 
-    /*! Initialize the data structures for the sweep-line algorithm. */
-    virtual void _init_red_structures ();
-    virtual void _init_blue_structures ();
+    Status_line_iterator& _status_line_insert_hint(Blue_tag)
+      {
+        return m_blue_status_line_insert_hint;
+      }
+
+    Subcurve*& _subcurves(Red_tag)
+      {
+        return m_red_subCurves;
+      }
+
+    Subcurve*& _subcurves(Blue_tag)
+      {
+        return m_blue_subCurves;
+      }
+
+    unsigned int& _num_of_subcurves(Red_tag)
+      {
+        return m_num_of_red_subCurves;
+      }
+
+    unsigned int& _num_of_subcurves(Blue_tag)
+      {
+        return m_num_of_blue_subCurves;
+      }
 
   public:
     /*! Compete the sweep (compete data strcures) */
     virtual void _complete_sweep();
 
+    // one halfedge per edge as key, the one directed from right to left
+    static const Halfedge* _edge_key(Halfedge_const_handle he)
+      {
+        return (he->direction() == ARR_RIGHT_TO_LEFT) ? &(*he) : &(*(he->twin()));
+      }
+
+    // the purple vertex of a meta point, if it has one already
+    bool _find_purple_vertex(const Point_2& p, Vertex_handle& vh)
+      {
+        if (!p.is_purple_vertex_empty())
+          {
+            vh = m_purple->non_const_handle(p.purple_vertex_handle());
+            return true;
+          }
+
+        CGAL_assertion(m_purple_vertices != 0);
+        typename Purple_vertex_map::iterator it =
+            m_purple_vertices->find(_vertex_key(p));
+        if (it == m_purple_vertices->end())
+          {
+            return false;
+          }
+        vh = it->second;
+        return true;
+      }
+
+    // make vh the purple vertex of the meta point p
+    void _set_purple_vertex(const Point_2& p, Vertex_handle vh)
+      {
+        vh->set_data(p.purple_data());
+        m_purple_vertices->insert(std::make_pair(_vertex_key(p), vh));
+      }
+
+    // the red vertex at p as key, or the blue one if there is none
+    static const Vertex* _vertex_key(const Point_2& p)
+      {
+        Vertex_const_handle vh = p.is_red_vertex_empty() ?
+            p.blue_vertex_handle() : p.red_vertex_handle();
+        return &(*vh);
+      }
+
+    // insert p as an isolated vertex into the purple face containing it;
+    // created is false if there is a vertex at p already. The forward sweep
+    // inserts an edge when it reaches its right end only, and no edge passes
+    // through an event point, so its bounded faces lie left of the sweep
+    // line and p, on or right of it, lies in the unbounded face. The
+    // mirrored sweep meets the faces of the forward one everywhere and has
+    // to locate p
+    Vertex_handle _insert_purple_point(const Base_point_2& p, bool& created)
+      {
+        created = true;
+        if (!Sweep_is_mirrored<Base_traits_2>::value)
+          {
+            CGAL_expensive_assertion_code(Purple_point_location pl(*m_purple));
+            CGAL_expensive_assertion_code(Object obj = pl.locate(p));
+            CGAL_expensive_assertion_code(const Face_const_handle* fh =
+                object_cast<Face_const_handle>(&obj));
+            CGAL_expensive_assertion(fh != NULL
+                && m_purple->non_const_handle(*fh) == m_purple->unbounded_face());
+            return m_purple->insert_in_face_interior(p,
+                m_purple->unbounded_face());
+          }
+
+        m_purple_locates++;
+        Purple_point_location pl(*m_purple);
+        Object obj = pl.locate(p);
+        const Vertex_const_handle* vh;
+        const Halfedge_const_handle* hh;
+        if ((vh = object_cast<Vertex_const_handle>(&obj)) != NULL)
+          {
+            created = false;
+            return m_purple->non_const_handle(*vh);
+          }
+        if ((hh = object_cast<Halfedge_const_handle>(&obj)) != NULL)
+          {
+            // a red blue intersection the forward sweep did not find
+            return _split_purple_edge(m_purple->non_const_handle(*hh), p);
+          }
+        const Face_const_handle* fh = object_cast<Face_const_handle>(&obj);
+        CGAL_assertion(fh != NULL);
+        return m_purple->insert_in_face_interior(p,
+            m_purple->non_const_handle(*fh));
+      }
+
+    // split the purple edge of he at p in its interior, both parts keep the
+    // data of the edge; returns the new vertex at p
+    Vertex_handle _split_purple_edge(Halfedge_handle he, const Base_point_2& p)
+      {
+        typename Arrangement_2::X_monotone_curve_2 c1, c2;
+        m_purple->geometry_traits()->split_2_object()(he->curve(), p, c1, c2);
+        typename Halfedge::Data data = he->data();
+
+        //c1 is the part at the xy-smaller end
+        Halfedge_handle first = (he->direction() == ARR_LEFT_TO_RIGHT) ?
+            m_purple->split_edge(he, c1, c2) : m_purple->split_edge(he, c2, c1);
+        first->set_data(data);
+        first->twin()->set_data(data);
+        first->next()->set_data(data);
+        first->next()->twin()->set_data(data);
+        return first->target();
+      }
+
     virtual void _init_curve_pairs();
 
   protected:
@@ -653,8 +909,9 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
      * \param curve The given x-monotone curve.
      * \param index Its unique index.
      */
-    void _init_red_curve (const X_monotone_curve_2& curve, unsigned int index);
-    void _init_blue_curve (const X_monotone_curve_2& curve, unsigned int index);
+    template<class Color>
+    void _init_curve (const X_monotone_curve_2& curve, unsigned int index,
+        Color);
 
     /*!
      * Initialize an event associated with an x-monotone curve end.
@@ -662,42 +919,32 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
      * \param ind Its end (ARR_MIN_END or ARR_MAX_END).
      * \param sc The subcurve corresponding to cv.
      */
-    void _init_red_curve_end (const X_monotone_curve_2& cv,
-        Arr_curve_end ind,
-        Subcurve* sc);
-
-    void _init_blue_curve_end (const X_monotone_curve_2& cv,
+    template<class Color>
+    void _init_curve_end (const X_monotone_curve_2& cv,
         Arr_curve_end ind,
-        Subcurve* sc);
+        Subcurve* sc,
+        Color);
 
     /*!
-     * Handle the subcurves that are to the left of the event point (i.e.,
-     * subcurves that we are done with).
+     * Handle the current event: its red and blue subcurves to the left and
+     * to the right, and the red blue merge at its point. Called once per
+     * event; the derived sweep dispatches on the colors from there.
      */
-    virtual void _handle_red_left_curves();
-    virtual void _handle_blue_left_curves();
-
-    //some special cases involving red blue intersections
-    virtual void prepare_red_blue_intersection();
-    virtual void prepare_red_blue_vertical();
+    virtual void _handle_event();
 
     /*!
      * Handle an event that does not have any incident left curves.
      * Such an event is usually the left endpoint of its incident right
      * subcurves, and we locate thei position in the status line.
      */
-    void _handle_event_without_red_left_curves ();
-    void _handle_event_without_blue_left_curves ();
+    template<class Color>
+    void _handle_event_without_left_curves (Color);
     /*!
      * Sort the left subcurves of an event point according to their order in
      * their status line (no geometric comprasions are needed).
      */
-    void _sort_red_left_curves ();
-    void _sort_blue_left_curves ();
-
-    /*! Handle the subcurves to the right of the current event point. */
-    virtual void _handle_red_right_curves ();
-    virtual void _handle_blue_right_curves ();
+    template<class Color>
+    void _sort_left_curves (Color);
 
     /*!
      * Add a subcurve to the right of an event point.
@@ -710,9 +957,21 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
     virtual bool _add_blue_curve_to_right (Event* event, Subcurve* curve,
         bool overlap_exist = false);
 
+    // the virtual hook of a color, for the code templated on it; only
+    // _push_event() calls it, for the input subcurves at initialization
+    bool _add_curve_to_right (Event* event, Subcurve* curve, Red_tag)
+      {
+        return _add_red_curve_to_right(event, curve);
+      }
+
+    bool _add_curve_to_right (Event* event, Subcurve* curve, Blue_tag)
+      {
+        return _add_blue_curve_to_right(event, curve);
+      }
+
     /*! Remove a curve from the status line. */
-    void _remove_curve_from_red_status_line (Subcurve *leftCurve);
-    void _remove_curve_from_blue_status_line (Subcurve *leftCurve);
+    template<class Color>
+    void _remove_curve_from_status_line (Subcurve *leftCurve, Color);
 
     /*!
      * Allocate an event object associated with a given point.
@@ -749,17 +1008,13 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
      *         indicating whether this is a new event (if false, the event
      *         was in the queue and we just updated it).
      */
-    std::pair<Event*, bool> _push_red_event (const Point_2& pt,
-        Attribute type,
-        Arr_parameter_space ps_x,
-        Arr_parameter_space ps_y,
-        Subcurve* sc = NULL);
-
-    std::pair<Event*, bool> _push_blue_event (const Point_2& pt,
+    template<class Color>
+    std::pair<Event*, bool> _push_event (const Point_2& pt,
         Attribute type,
         Arr_parameter_space ps_x,
         Arr_parameter_space ps_y,
-        Subcurve* sc = NULL);
+        Subcurve* sc,
+        Color);
 
     /*!
      * Push an event point associated with a curve end into the event queue.
@@ -773,19 +1028,14 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
      *         indicating whether this is a new event (if false, the event
      *         was in the queue and we just updated it).
      */
-    std::pair<Event*, bool> _push_red_event (const X_monotone_curve_2& cv,
+    template<class Color>
+    std::pair<Event*, bool> _push_event (const X_monotone_curve_2& cv,
         Arr_curve_end ind,
         Attribute type,
         Arr_parameter_space ps_x,
         Arr_parameter_space ps_y,
-        Subcurve* sc = NULL);
-
-    std::pair<Event*, bool> _push_blue_event (const X_monotone_curve_2& cv,
-        Arr_curve_end ind,
-        Attribute type,
-        Arr_parameter_space ps_x,
-        Arr_parameter_space ps_y,
-        Subcurve* sc = NULL);
+        Subcurve* sc,
+        Color);
 
 //    void _update_event_at_infinity(Event* e,
 //        const X_monotone_curve_2& cv,
@@ -812,8 +1062,6 @@ typedef    typename Traits_adaptor_2::Point_2 Point_2;
 //        CGAL_error();
 //      }
 
-    virtual void proceed_according_to_vertex_type();
-
     void PrintEventQueue();
     void PrintRedSubCurves();
     void PrintBlueSubCurves();
@@ -45,11 +45,15 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
         m_num_of_blue_subCurves(0)
   {
     m_purple = new Arr();
+    m_purple_intersections = 0;
+    m_purple_vertices = 0;
+    m_purple_locates = 0;
     dummy_sub = new Subcv();
     lower_dummy = 0;
     upper_dummy = 0;
     c_red_below = 0;
     c_blue_below = 0;
+    m_currentEvent = 0;
     b_color = Traits_2::DUMMY;
   }
 
@@ -70,43 +74,8 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     delete m_scouts;
     delete dummy_sub;
 
-    if (lower_dummy != 0)
-      {
-        delete lower_dummy;
-      }
-
-    if (upper_dummy != 0)
-      {
-        delete upper_dummy;
-      }
-
-    // Free all the event that have not been de-allocated so far.
-    Allocated_events_iterator iter;
-    Event *p_event;
-
-    for (iter = m_allocated_events.begin(); iter != m_allocated_events.end(); ++iter)
-      {
-        p_event = *iter;
-        m_eventAlloc.destroy(p_event);
-        m_eventAlloc.deallocate(p_event, 1);
-      }
-  }
-
-//-----------------------------------------------------------------------------
-// Deallocate event object..
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::deallocate_event(
-      Event* event)
-  {
-    // Remove the event from the set of allocated events.
-    m_allocated_events.erase(event);
-
-    // Perfrom the actual deallocation.
-    m_eventAlloc.destroy(event);
-    m_eventAlloc.deallocate(event, 1);
-    return;
+    // The arenas free the events, overlap subcurves and scouts that have
+    // not been released by _complete_sweep().
   }
 
 //-----------------------------------------------------------------------------
@@ -122,38 +91,31 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     Event_queue_iterator eventIter = m_queue->begin();
 
     bool first = true;
+    unsigned int x_index = 1;
     while (eventIter != m_queue->end())
       {
         // Get the next event from the queue.
         m_currentEvent = *eventIter;
         m_currentEventIter = eventIter;
 
-        //reset curves below if we are at a new x-value
+        //reset curves below if we are at a new x-value; a new index also
+        //invalidates the y-values the subcurves cached at the previous one
         if (!first)
           {
             if (this->current_event_point.base().x()
-                < this->m_currentEvent->point().base().x())
+                != this->m_currentEvent->point().base().x())
               {
                 this->set_current_red_below(0);
                 this->set_current_blue_below(0);
+                x_index++;
               }
           }
         first = false;
+        m_currentEvent->set_x_index(x_index);
 
         current_event_point = m_currentEvent->point();
 
-        // before the _handle_..._curves functions we might have to take care
-        // of some special cases
-        prepare_red_blue_intersection();
-        prepare_red_blue_vertical();
-
-        //handling done by the sweep line framework
-        _handle_red_left_curves();
-        _handle_blue_left_curves();
-        _handle_red_right_curves();
-        _handle_blue_right_curves();
-
-        proceed_according_to_vertex_type();
+        _handle_event();
 
         MY_CGAL_SL_DEBUG(this->_validate_invariants(););
 
@@ -166,29 +128,15 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // Initialize the data structures for the sweep-line algorithm.
 //
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_init_red_structures()
+  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_init_structures(Color)
   {
     //  CGAL_assertion(m_queue->empty());
-    CGAL_assertion((m_red_statusLine.size() == 0));
+    CGAL_assertion((_status_line(Color()).size() == 0));
 
     // Allocate all of the Subcurve objects as one block.
-    m_red_subCurves = m_subCurveAlloc.allocate(m_num_of_red_subCurves);
-    return;
-  }
-
-//-----------------------------------------------------------------------------
-// Initialize the data structures for the sweep-line algorithm.
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_init_blue_structures()
-  {
-    //CGAL_assertion(m_queue->empty());
-    CGAL_assertion((m_blue_statusLine.size() == 0));
-
-    // Allocate all of the Subcurve objects as one block.
-    m_blue_subCurves = m_subCurveAlloc.allocate(m_num_of_blue_subCurves);
+    _subcurves(Color()) = m_subCurveAlloc.allocate(_num_of_subcurves(Color()));
     return;
   }
 
@@ -217,6 +165,13 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     if (m_num_of_blue_subCurves > 0)
       m_subCurveAlloc.deallocate(m_blue_subCurves, m_num_of_blue_subCurves);
 
+    // Release the events, the overlap subcurves and the scouts in bulk.
+    m_event_arena.clear();
+    m_overlap_subcurve_arena.clear();
+    m_scout_arena.clear();
+    lower_dummy = 0;
+    upper_dummy = 0;
+
     return;
   }
 
@@ -242,8 +197,8 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     // Create the event, or obtain an existing event in the queue.
     // Note that an isolated point does not have any boundary conditions.
 
-    const std::pair<Event*, bool>& pair_res = _push_red_event(pt, type,
-        ARR_INTERIOR, ARR_INTERIOR);//subcurve == NULL, darum egal, ob push_red oder push_blue
+    const std::pair<Event*, bool>& pair_res = _push_event(pt, type,
+        ARR_INTERIOR, ARR_INTERIOR, 0, Red_tag());//subcurve == NULL, darum egal, ob push_red oder push_blue
 
     return;
   }
@@ -252,44 +207,22 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // Initialize the events associated with an x-monotone curve.
 //
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_init_red_curve(
-      const X_monotone_curve_2& curve, unsigned int index)
+  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_init_curve(
+      const X_monotone_curve_2& curve, unsigned int index, Color)
   {
 
     CGAL_assertion(curve.left_is_set());
     CGAL_assertion(curve.right_is_set());
     // Construct an initialize a subcurve object.
-    m_subCurveAlloc.construct(m_red_subCurves + index, m_masterSubcurve);
-
-    (m_red_subCurves + index)->init_subcurve(curve);
-
-    // Create two events associated with the curve ends.
-    _init_red_curve_end(curve, ARR_MAX_END, m_red_subCurves + index);
-    _init_red_curve_end(curve, ARR_MIN_END, m_red_subCurves + index);
-
-    return;
-  }
-
-//-----------------------------------------------------------------------------
-// Initialize the events associated with an x-monotone curve.
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_init_blue_curve(
-      const X_monotone_curve_2& curve, unsigned int index)
-  {
-    CGAL_assertion(curve.left_is_set());
-    CGAL_assertion(curve.right_is_set());
-
-    // Construct an initialize a subcurve object.
-    m_subCurveAlloc.construct(m_blue_subCurves + index, m_masterSubcurve);
+    m_subCurveAlloc.construct(_subcurves(Color()) + index, m_masterSubcurve);
 
-    (m_blue_subCurves + index)->init_subcurve(curve);
+    (_subcurves(Color()) + index)->init_subcurve(curve);
 
     // Create two events associated with the curve ends.
-    _init_blue_curve_end(curve, ARR_MAX_END, m_blue_subCurves + index);
-    _init_blue_curve_end(curve, ARR_MIN_END, m_blue_subCurves + index);
+    _init_curve_end(curve, ARR_MAX_END, _subcurves(Color()) + index, Color());
+    _init_curve_end(curve, ARR_MIN_END, _subcurves(Color()) + index, Color());
 
     return;
   }
@@ -298,9 +231,10 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // Initialize an event associated with an x-monotone curve end.
 //
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_init_red_curve_end(
-      const X_monotone_curve_2& cv, Arr_curve_end ind, Subcurve* sc)
+  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_init_curve_end(
+      const X_monotone_curve_2& cv, Arr_curve_end ind, Subcurve* sc, Color)
   {
     // Get the boundary conditions of the curve end.
     const Attribute end_attr = (ind == ARR_MIN_END) ? Base_event::LEFT_END
@@ -325,11 +259,11 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 
         if (ps_x == ARR_INTERIOR && ps_y == ARR_INTERIOR)
           {
-            pair_res = _push_red_event(pt, end_attr, ps_x, ps_y, sc);
+            pair_res = _push_event(pt, end_attr, ps_x, ps_y, sc, Color());
           }
         else
           {
-            pair_res = _push_red_event(cv, ind, end_attr, ps_x, ps_y, sc);
+            pair_res = _push_event(cv, ind, end_attr, ps_x, ps_y, sc, Color());
           }
 
         // Inform the visitor in case we updated an existing event.
@@ -341,7 +275,7 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     else
       {
         // The curve end is unbounded, insert it into the event queue.
-        pair_res = _push_red_event(cv, ind, end_attr, ps_x, ps_y, sc);
+        pair_res = _push_event(cv, ind, end_attr, ps_x, ps_y, sc, Color());
 
         // Inform the visitor in case we updated an existing event.
         Event *e = pair_res.first;
@@ -354,94 +288,11 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
   }
 
 //-----------------------------------------------------------------------------
-// Initialize an event associated with an x-monotone curve end.
+// Handle the current event.
 //
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
   void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_init_blue_curve_end(
-      const X_monotone_curve_2& cv, Arr_curve_end ind, Subcurve* sc)
-  {
-    // Get the boundary conditions of the curve end.
-    const Attribute end_attr = (ind == ARR_MIN_END) ? Base_event::LEFT_END
-        : Base_event::RIGHT_END;
-
-    Arr_parameter_space ps_x = m_traits->parameter_space_in_x_2_object()(cv,
-        ind);
-    Arr_parameter_space ps_y = m_traits->parameter_space_in_y_2_object()(cv,
-        ind);
-
-    // Create the corresponding event an push it into the event queue.
-    std::pair<Event*, bool> pair_res;
-
-    if (/*m_traits->is_bounded_2_object()(cv, ind)*/true)
-      {
-        // The curve end is bounded and associated with a valid endpoint.
-        const Point_2
-            & pt =
-                (ind == ARR_MIN_END) ? m_traits->construct_min_vertex_2_object()(
-                    cv)
-                    : m_traits->construct_max_vertex_2_object()(cv);
-
-        if (ps_x == ARR_INTERIOR && ps_y == ARR_INTERIOR)
-          {
-            pair_res = _push_blue_event(pt, end_attr, ps_x, ps_y, sc);
-          }
-        else
-          {
-            pair_res = _push_blue_event(cv, ind, end_attr, ps_x, ps_y, sc);
-          }
-
-        // Inform the visitor in case we updated an existing event.
-        Event *e = pair_res.first;
-
-        CGAL_assertion(e->is_finite());
-        //m_visitor->update_event (e, pt, cv, ind, pair_res.second);
-      }
-    else
-      {
-        // The curve end is unbounded, insert it into the event queue.
-        pair_res = _push_blue_event(cv, ind, end_attr, ps_x, ps_y, sc);
-
-        // Inform the visitor in case we updated an existing event.
-        Event *e = pair_res.first;
-
-        CGAL_assertion(!e->is_finite());
-        //_update_event_at_infinity(e, cv, ind, pair_res.second);
-      }
-
-    return;
-  }
-
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::prepare_red_blue_intersection()
-  {
-    //virtual
-  }
-
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::prepare_red_blue_vertical()
-  {
-    //virtual
-  }
-
-//-----------------------------------------------------------------------------
-// Handle the subcurves to the left of the current event point.
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_handle_red_left_curves()
-  {
-    //virtual
-  }
-
-//-----------------------------------------------------------------------------
-// Handle the subcurves to the left of the current event point.
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_handle_blue_left_curves()
+  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_handle_event()
   {
     //virtual
   }
@@ -450,8 +301,9 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // Handle an event that does not have any incident left curves.
 //
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_handle_event_without_red_left_curves()
+  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_handle_event_without_left_curves(Color)
   {
     // Check if the event is a boundary event or not.
     const Arr_parameter_space ps_x = m_currentEvent->parameter_space_in_x();
@@ -463,10 +315,10 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
         // this point on the status line (note this point may be located on a
         // subcurve in the status line).
         const std::pair<Status_line_iterator, bool>& pair_res =
-            m_red_statusLine.find_lower(m_currentEvent->point(),
+            _status_line(Color()).find_lower(m_currentEvent->point(),
                 m_statusLineCurveLess);
 
-        m_red_status_line_insert_hint = pair_res.first;
+        _status_line_insert_hint(Color()) = pair_res.first;
         m_is_event_on_above = pair_res.second;
 
         return;
@@ -480,7 +332,7 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
         // We are still sweeping the left boundary, so by the way we have ordered
         // the events in the queue, we know that the new event should be placed
         // above all other subcurves in the status line.
-        m_red_status_line_insert_hint = m_red_statusLine.end();
+        _status_line_insert_hint(Color()) = _status_line(Color()).end();
       }
     else
       {
@@ -493,71 +345,12 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
         // above all other subcurves.
         if (ps_y == ARR_BOTTOM_BOUNDARY)
           {
-            m_red_status_line_insert_hint = m_red_statusLine.begin();
+            _status_line_insert_hint(Color()) = _status_line(Color()).begin();
           }
         else
           {
             CGAL_assertion(ps_y == ARR_TOP_BOUNDARY);
-            m_red_status_line_insert_hint = m_red_statusLine.end();
-          }
-      }
-
-    return;
-  }
-
-//-----------------------------------------------------------------------------
-// Handle an event that does not have any incident left curves.
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_handle_event_without_blue_left_curves()
-  {
-    // Check if the event is a boundary event or not.
-    const Arr_parameter_space ps_x = m_currentEvent->parameter_space_in_x();
-    const Arr_parameter_space ps_y = m_currentEvent->parameter_space_in_y();
-
-    if (ps_x == ARR_INTERIOR && ps_y == ARR_INTERIOR)
-      {
-        // The event is associated with a valid point - locate the position of
-        // this point on the status line (note this point may be located on a
-        // subcurve in the status line).
-        const std::pair<Status_line_iterator, bool>& pair_res =
-            m_blue_statusLine.find_lower(m_currentEvent->point(),
-                m_statusLineCurveLess);
-
-        m_blue_status_line_insert_hint = pair_res.first;
-        m_is_event_on_above = pair_res.second;
-
-        return;
-      }
-
-    // We have a boundary event, so we can easily locate a plave for it in the
-    // status line.
-
-    if (ps_x == ARR_LEFT_BOUNDARY)
-      {
-        // We are still sweeping the left boundary, so by the way we have ordered
-        // the events in the queue, we know that the new event should be placed
-        // above all other subcurves in the status line.
-        m_blue_status_line_insert_hint = m_blue_statusLine.end();
-      }
-    else
-      {
-        // Note that an event with a positive boundary condition at x can only
-        // represent a right end of a curve.
-        CGAL_assertion(ps_x != ARR_RIGHT_BOUNDARY);
-
-        // If the sign of the boundary in y is negative, the event should be
-        // inserted below all other subcurves; if it is possitive, the event is
-        // above all other subcurves.
-        if (ps_y == ARR_BOTTOM_BOUNDARY)
-          {
-            m_blue_status_line_insert_hint = m_blue_statusLine.begin();
-          }
-        else
-          {
-            CGAL_assertion(ps_y == ARR_TOP_BOUNDARY);
-            m_blue_status_line_insert_hint = m_blue_statusLine.end();
+            _status_line_insert_hint(Color()) = _status_line(Color()).end();
           }
       }
 
@@ -569,25 +362,26 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // their status line (no geometric comprasions are needed).
 //
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_sort_red_left_curves()
+  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_sort_left_curves(Color)
   {
-    CGAL_assertion(m_currentEvent->has_red_left_curves());
+    CGAL_assertion(m_currentEvent->has_left_curves(Color()));
 
     // Get the first curve associated with the event and its position on the
     // status line. We proceed from this position up the status line until
     // we encounter a subcurve that is not associated with the current event.
-    Subcurve *curve = *(m_currentEvent->red_left_curves_begin());
+    Subcurve *curve = *(m_currentEvent->left_curves_begin(Color()));
     Status_line_iterator sl_iter = curve->hint();
 
     CGAL_assertion(*sl_iter == curve);
     sl_iter++;
 
-    for (/*++sl_iter*/; sl_iter != m_red_statusLine.end(); ++sl_iter)
+    for (/*++sl_iter*/; sl_iter != _status_line(Color()).end(); ++sl_iter)
       {
-        if (std::find(m_currentEvent->red_left_curves_begin(),
-            m_currentEvent->red_left_curves_end(), *sl_iter)
-            == m_currentEvent->red_left_curves_end())
+        if (std::find(m_currentEvent->left_curves_begin(Color()),
+            m_currentEvent->left_curves_end(Color()), *sl_iter)
+            == m_currentEvent->left_curves_end(Color()))
           {
             break;
           }
@@ -596,28 +390,28 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     Status_line_iterator end = sl_iter;
 
     sl_iter = curve->hint();
-    if (sl_iter == m_red_statusLine.begin())
+    if (sl_iter == _status_line(Color()).begin())
       {
         // In case the lowest subcurve in the status line is associated with the
         // current event, we have the range of (sorted) subcurves ready. We
         // associate this range with the event, so the curves are now sorted
         // according to their vertical positions immediately to the left of the
         // event.
-        m_currentEvent->replace_red_left_curves(sl_iter, end);
+        m_currentEvent->replace_left_curves(sl_iter, end, Color());
         return;
       }
 
     // Go down the status line until we encounter a subcurve that is not
     // associated with the current event.
     --sl_iter;
-    for (; sl_iter != m_red_statusLine.begin(); --sl_iter)
+    for (; sl_iter != _status_line(Color()).begin(); --sl_iter)
       {
-        if (std::find(m_currentEvent->red_left_curves_begin(),
-            m_currentEvent->red_left_curves_end(), *sl_iter)
-            == m_currentEvent->red_left_curves_end())
+        if (std::find(m_currentEvent->left_curves_begin(Color()),
+            m_currentEvent->left_curves_end(Color()), *sl_iter)
+            == m_currentEvent->left_curves_end(Color()))
           {
             // Associate the sorted range of subcurves with the event.
-            m_currentEvent->replace_red_left_curves(++sl_iter, end);
+            m_currentEvent->replace_left_curves(++sl_iter, end, Color());
             return;
           }
       }
@@ -625,110 +419,20 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     // Check if the subcurve at the current iterator position should be
     // associated with the current event, and select the (sorted) range of
     // subcurves accordingly.
-    if (std::find(m_currentEvent->red_left_curves_begin(),
-        m_currentEvent->red_left_curves_end(), *sl_iter)
-        == m_currentEvent->red_left_curves_end())
+    if (std::find(m_currentEvent->left_curves_begin(Color()),
+        m_currentEvent->left_curves_end(Color()), *sl_iter)
+        == m_currentEvent->left_curves_end(Color()))
       {
-        m_currentEvent->replace_red_left_curves(++sl_iter, end);;
+        m_currentEvent->replace_left_curves(++sl_iter, end, Color());;
       }
     else
       {
-        m_currentEvent->replace_red_left_curves(sl_iter, end);
+        m_currentEvent->replace_left_curves(sl_iter, end, Color());
       }
 
     return;
   }
 
-//-----------------------------------------------------------------------------
-// Sort the left subcurves of an event point according to their order in
-// their status line (no geometric comprasions are needed).
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_sort_blue_left_curves()
-  {
-    CGAL_assertion(m_currentEvent->has_blue_left_curves());
-
-    // Get the first curve associated with the event and its position on the
-    // status line. We proceed from this position up the status line until
-    // we encounter a subcurve that is not associated with the current event.
-    Subcurve *curve = *(m_currentEvent->blue_left_curves_begin());
-    Status_line_iterator sl_iter = curve->hint();
-    CGAL_assertion(*sl_iter == curve);
-
-    for (++sl_iter; sl_iter != m_blue_statusLine.end(); ++sl_iter)
-      {
-        if (std::find(m_currentEvent->blue_left_curves_begin(),
-            m_currentEvent->blue_left_curves_end(), *sl_iter)
-            == m_currentEvent->blue_left_curves_end())
-          break;
-      }
-    Status_line_iterator end = sl_iter;
-
-    sl_iter = curve->hint();
-    if (sl_iter == m_blue_statusLine.begin())
-      {
-        // In case the lowest subcurve in the status line is associated with the
-        // current event, we have the range of (sorted) subcurves ready. We
-        // associate this range with the event, so the curves are now sorted
-        // according to their vertical positions immediately to the left of the
-        // event.
-        m_currentEvent->replace_blue_left_curves(sl_iter, end);
-        return;
-      }
-
-    // Go down the status line until we encounter a subcurve that is not
-    // associated with the current event.
-    --sl_iter;
-    for (; sl_iter != m_blue_statusLine.begin(); --sl_iter)
-      {
-        if (std::find(m_currentEvent->blue_left_curves_begin(),
-            m_currentEvent->blue_left_curves_end(), *sl_iter)
-            == m_currentEvent->blue_left_curves_end())
-          {
-            // Associate the sorted range of subcurves with the event.
-            m_currentEvent->replace_blue_left_curves(++sl_iter, end);
-            return;
-          }
-      }
-
-    // Check if the subcurve at the current iterator position should be
-    // associated with the current event, and select the (sorted) range of
-    // subcurves accordingly.
-    if (std::find(m_currentEvent->blue_left_curves_begin(),
-        m_currentEvent->blue_left_curves_end(), *sl_iter)
-        == m_currentEvent->blue_left_curves_end())
-      {
-        m_currentEvent->replace_blue_left_curves(++sl_iter, end);;
-      }
-    else
-      {
-        m_currentEvent->replace_blue_left_curves(sl_iter, end);
-      }
-
-    return;
-  }
-
-//-----------------------------------------------------------------------------
-// Handle the subcurves to the right of the current event point.
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_handle_red_right_curves()
-  {
-    //virtual
-  }
-
-//-----------------------------------------------------------------------------
-// Handle the subcurves to the right of the current event point.
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_handle_blue_right_curves()
-  {
-    //virtual
-  }
-
 //-----------------------------------------------------------------------------
 // Add a subcurve to the right of an event point.
 //
@@ -752,46 +456,25 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // Remove a curve from the status line.
 //
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_remove_curve_from_red_status_line(
-      Subcurve *sc)
+  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_remove_curve_from_status_line(
+      Subcurve *sc, Color)
   {
     // Get the position of the subcurve on the status line.
     Status_line_iterator sl_iter = sc->hint();
-    CGAL_assertion(sl_iter != m_red_statusLine.end());
+    CGAL_assertion(sl_iter != _status_line(Color()).end());
 
     // The position of the next event can be right after the deleted subcurve.
-    m_red_status_line_insert_hint = sl_iter;
-    ++m_red_status_line_insert_hint;
+    _status_line_insert_hint(Color()) = sl_iter;
+    ++_status_line_insert_hint(Color());
 
     // Erase the subcurve from the status line.
-    m_red_statusLine.erase(sl_iter);
+    _status_line(Color()).erase(sl_iter);
     ////MY_CGAL_PRINT      ("remove_curve_from_red_status_line Done\n";)
     return;
   }
 
-//-----------------------------------------------------------------------------
-// Remove a curve from the status line.
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_remove_curve_from_blue_status_line(
-      Subcurve *sc)
-  {
-    // Get the position of the subcurve on the status line.
-    Status_line_iterator sl_iter = sc->hint();
-    CGAL_assertion(sl_iter != m_blue_statusLine.end());
-
-    // The position of the next event can be right after the deleted subcurve.
-    m_blue_status_line_insert_hint = sl_iter;
-    ++m_blue_status_line_insert_hint;
-
-    // Erase the subcurve from the status line.
-    m_blue_statusLine.erase(sl_iter);
-    ////MY_CGAL_PRINT  ("remove_curve_from_blue_status_line Done\n";)
-    return;
-  }
-
 //-----------------------------------------------------------------------------
 // Allocate an event object associated with a valid point.
 //
@@ -802,12 +485,8 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
       Arr_parameter_space ps_y)
   {
     // Allocate the event.
-    Event *e = m_eventAlloc.allocate(1);
-    m_eventAlloc.construct(e, m_masterEvent);
+    Event *e = m_event_arena.construct(m_masterEvent);
     e->init(pt, type, ps_x, ps_y);
-
-    // Insert it to the set of allocated events.
-    m_allocated_events.insert(e);
     return (e);
   }
 
@@ -819,11 +498,8 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
   My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_allocate_event_at_infinity(
       Attribute type, Arr_parameter_space ps_x, Arr_parameter_space ps_y)
   {
-    Event *e = m_eventAlloc.allocate(1);
-    m_eventAlloc.construct(e, m_masterEvent);
+    Event *e = m_event_arena.construct(m_masterEvent);
     e->init_at_infinity(type, ps_x, ps_y);
-
-    m_allocated_events.insert(e);
     return (e);
   }
 
@@ -831,11 +507,12 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // Push a finite event point into the event queue.
 //
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   std::pair<
       typename My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::Event*, bool>
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_push_red_event(
+  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_push_event(
       const Point_2& pt, Attribute type, Arr_parameter_space ps_x,
-      Arr_parameter_space ps_y, Subcurve* sc)
+      Arr_parameter_space ps_y, Subcurve* sc, Color)
   {
 
     // Look for the point in the event queue.
@@ -873,77 +550,13 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
         if (type == Base_event::LEFT_END)
           {
             sc->set_left_event(e);
-            _add_red_curve_to_right(e, sc);
-          }
-        else
-          {
-            CGAL_assertion(type == Base_event::RIGHT_END);
-            sc->set_right_event(e);
-            e->add_red_curve_to_left(sc);
-          }
-      }
-
-    if (!exist)
-      {
-        // Insert the new event into the queue using the hint we got when we
-        // looked for it.
-        m_queue->insert_before(pair_res.first, e);
-      }
-    ////MY_CGAL_PRINT_NEW_EVENT(pt, e);
-
-    // Return the resulting event and a flag indicating whether we have created
-    // a new event.
-    return (std::make_pair(e, !exist));
-  }
-
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  std::pair<
-      typename My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::Event*, bool>
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_push_blue_event(
-      const Point_2& pt, Attribute type, Arr_parameter_space ps_x,
-      Arr_parameter_space ps_y, Subcurve* sc)
-  {
-    // Look for the point in the event queue.
-    Event* e;
-    m_queueEventLess.set_parameter_space_in_x(ps_x);
-    m_queueEventLess.set_parameter_space_in_y(ps_y);
-
-    const std::pair<Event_queue_iterator, bool>& pair_res =
-        m_queue->find_lower(pt, m_queueEventLess);
-    const bool exist = pair_res.second;
-
-    if (!exist)
-      {
-        // The point is not found in the event queue - create a new event and
-        // insert it into the queue.
-        e = _allocate_event(pt, type, ps_x, ps_y);
-      }
-    else
-      {
-        // The event associated with the given point already exists in the queue,
-        // so we just have to update it.
-        e = *(pair_res.first);
-        CGAL_assertion(e->is_finite());
-
-        e->set_attribute(type);
-      }
-
-    // If we are given a subcurve that the event represents one of its
-    // endpoints, update the event and the subcurve records accordingly.
-    // Note that this must be done before we actually insert the new event
-    // into the event queue.
-    if (sc != NULL)
-      {
-        if (type == Base_event::LEFT_END)
-          {
-            sc->set_left_event(e);
-            _add_blue_curve_to_right(e, sc);
+            _add_curve_to_right(e, sc, Color());
           }
         else
           {
             CGAL_assertion(type == Base_event::RIGHT_END);
             sc->set_right_event(e);
-            e->add_blue_curve_to_left(sc);
+            e->add_curve_to_left(sc, Color());
           }
       }
 
@@ -964,11 +577,12 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // Push an event point associated with a curve end into the event queue.
 //
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   std::pair<
       typename My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::Event*, bool>
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_push_red_event(
+  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_push_event(
       const X_monotone_curve_2& cv, Arr_curve_end ind, Attribute type,
-      Arr_parameter_space ps_x, Arr_parameter_space ps_y, Subcurve* sc)
+      Arr_parameter_space ps_x, Arr_parameter_space ps_y, Subcurve* sc, Color)
   {
     // Look for the curve end in the event queue.
     Event* e;
@@ -1023,13 +637,13 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
         if (type == Base_event::LEFT_END)
           {
             sc->set_left_event(e);
-            _add_red_curve_to_right(e, sc);
+            _add_curve_to_right(e, sc, Color());
           }
         else
           {
             CGAL_assertion(type == Base_event::RIGHT_END);
             sc->set_right_event(e);
-            e->add_red_curve_to_left(sc);
+            e->add_curve_to_left(sc, Color());
           }
       }
 
@@ -1043,96 +657,6 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     return (std::make_pair(e, !exist));
   }
 
-//-----------------------------------------------------------------------------
-// Push an event point associated with a curve end into the event queue.
-//
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  std::pair<
-      typename My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::Event*, bool>
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::_push_blue_event(
-      const X_monotone_curve_2& cv, Arr_curve_end ind, Attribute type,
-      Arr_parameter_space ps_x, Arr_parameter_space ps_y, Subcurve* sc)
-  {
-    // Look for the curve end in the event queue.
-    Event* e;
-
-    m_queueEventLess.set_parameter_space_in_x(ps_x);
-    m_queueEventLess.set_parameter_space_in_y(ps_y);
-    m_queueEventLess.set_index(ind);
-
-    const std::pair<Event_queue_iterator, bool>& pair_res =
-        m_queue->find_lower(cv, m_queueEventLess);
-    const bool exist = pair_res.second;
-
-    if (!exist)
-      {
-        // The curve end is not found in the event queue - create a new event and
-        // insert it into the queue.
-        if (/*m_traits->is_bounded_2_object()(cv, ind)*/true)
-          {
-            // The curve end is not unbounded, so it is associated with a valid
-            // point.
-            const Point_2
-                & pt =
-                    (ind == ARR_MIN_END) ? m_traits->construct_min_vertex_2_object()(
-                        cv)
-                        : m_traits->construct_max_vertex_2_object()(cv);
-
-            e = _allocate_event(pt, type, ps_x, ps_y);
-          }
-        else
-          {
-            // The curve end is unbounded, so we create an event at infinity.
-            e = _allocate_event_at_infinity(type, ps_x, ps_y);
-          }
-      }
-    else
-      {
-        // The event associated with the given curve end already exists in the
-        // queue, so we just have to update it.
-        e = *(pair_res.first);
-        CGAL_assertion(e->parameter_space_in_x() == ps_x
-            && e->parameter_space_in_y() == ps_y);
-
-        e->set_attribute(type);
-      }
-
-    // If we are given a subcurve that the event represents one of its
-    // endpoints, update the event and the subcurve records accordingly.
-    // Note that this must be done before we actually insert the new event
-    // into the event queue.
-    if (sc != NULL)
-      {
-        if (type == Base_event::LEFT_END)
-          {
-            sc->set_left_event(e);
-            _add_blue_curve_to_right(e, sc);
-          }
-        else
-          {
-            CGAL_assertion(type == Base_event::RIGHT_END);
-            sc->set_right_event(e);
-            e->add_blue_curve_to_left(sc);
-          }
-      }
-
-    if (!exist)
-      {
-        // Insert the new event into the queue using the hint we got when we
-        // looked for it.
-        m_queue->insert_before(pair_res.first, e);
-      }
-
-    return (std::make_pair(e, !exist));
-  }
-
-template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
-  void
-  My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::proceed_according_to_vertex_type()
-  {
-    //virtual
-  }
-
 CGAL_END_NAMESPACE
 
 #endif
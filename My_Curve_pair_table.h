@@ -0,0 +1,160 @@
+#ifndef MY_CURVE_PAIR_TABLE_H
+#define MY_CURVE_PAIR_TABLE_H
+
+#include <CGAL/basic.h>
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/*! \file
+ * a flat hash set of unordered pairs of subcurves, used by the sweep to
+ * remember the pairs it has already intersected
+ * by Jannis Warnat
+ */
+
+CGAL_BEGIN_NAMESPACE
+
+/*! \class
+ * An open-addressing (linear probing) set of subcurve pairs. The slots are
+ * one array of pointer pairs, so a lookup touches one or two cache lines
+ * and never allocates. reserve() sizes the table for a number of pairs at
+ * a load factor of at most 1/2; it only grows if more pairs are inserted,
+ * which grows() counts.
+ */
+template<class Subcurve_>
+class Curve_pair_table
+  {
+  public:
+
+    typedef Subcurve_ Subcurve;
+
+  private:
+
+    // an empty slot has first == 0
+    struct Slot
+      {
+        const Subcurve* first;
+        const Subcurve* second;
+      };
+
+    std::vector<Slot> m_slots;
+    std::size_t m_mask; // number of slots - 1, a power of two minus one
+    std::size_t m_size;
+    std::size_t m_grows; // times the reserved slots were outgrown
+
+  public:
+
+    Curve_pair_table() :
+      m_mask(0), m_size(0), m_grows(0)
+      {
+      }
+
+    /*! Make room for n pairs without growing. Drops the stored pairs. */
+    void reserve(std::size_t n)
+      {
+        std::size_t capacity = 16;
+        while (capacity < 2 * n)
+          {
+            capacity *= 2;
+          }
+        Slot empty = { 0, 0 };
+        m_slots.assign(capacity, empty);
+        m_mask = capacity - 1;
+        m_size = 0;
+      }
+
+    /*!
+     * Insert the pair {c1, c2}.
+     * \return (true) if the pair is new; (false) if it was already stored.
+     */
+    bool insert(const Subcurve* c1, const Subcurve* c2)
+      {
+        CGAL_precondition(c1 != 0 && c2 != 0);
+        if (2 * (m_size + 1) > m_slots.size())
+          {
+            _grow();
+          }
+
+        if (c2 < c1)
+          {
+            std::swap(c1, c2);
+          }
+
+        std::size_t i = _hash(c1, c2) & m_mask;
+        while (m_slots[i].first != 0)
+          {
+            if (m_slots[i].first == c1 && m_slots[i].second == c2)
+              {
+                return false;
+              }
+            i = (i + 1) & m_mask;
+          }
+        m_slots[i].first = c1;
+        m_slots[i].second = c2;
+        m_size++;
+        return true;
+      }
+
+    std::size_t size() const
+      {
+        return m_size;
+      }
+
+    std::size_t capacity() const
+      {
+        return m_slots.size() / 2;
+      }
+
+    /*! The number of times the table outgrew its reserved size. */
+    std::size_t grows() const
+      {
+        return m_grows;
+      }
+
+    /*! Remove all pairs, keeping the slots for the next sweep. */
+    void clear()
+      {
+        if (m_size == 0)
+          {
+            return;
+          }
+        Slot empty = { 0, 0 };
+        std::fill(m_slots.begin(), m_slots.end(), empty);
+        m_size = 0;
+      }
+
+  private:
+
+    // subcurves are at least 8-byte aligned, so the low bits are dropped
+    // before mixing the two addresses
+    static std::size_t _hash(const Subcurve* c1, const Subcurve* c2)
+      {
+        std::size_t h = (reinterpret_cast<std::size_t>(c1) >> 3)
+            * 2654435761u;
+        h ^= (reinterpret_cast<std::size_t>(c2) >> 3) + (h << 6) + (h >> 2);
+        return h ^ (h >> 16);
+      }
+
+    // double the number of slots and reinsert the stored pairs
+    void _grow()
+      {
+        std::vector<Slot> old;
+        old.swap(m_slots);
+        if (!old.empty())
+          {
+            m_grows++;
+          }
+        reserve(old.empty() ? 8 : old.size());
+        for (std::size_t i = 0; i < old.size(); i++)
+          {
+            if (old[i].first != 0)
+              {
+                insert(old[i].first, old[i].second);
+              }
+          }
+      }
+  };
+
+CGAL_END_NAMESPACE
+
+#endif
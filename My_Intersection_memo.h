@@ -0,0 +1,85 @@
+#ifndef MY_INTERSECTION_MEMO_H
+#define MY_INTERSECTION_MEMO_H
+
+#include <CGAL/basic.h>
+#include <cstddef>
+#include <map>
+#include <utility>
+
+/*! \file
+ * the crossing points of red and blue input segments, computed once and
+ * shared by all intersections of their pieces during a merge
+ * by Jannis Warnat
+ */
+
+CGAL_BEGIN_NAMESPACE
+
+/*! \class
+ * Maps a pair of input segments, given by the indices stored with their
+ * halfedges, to the point where their supporting lines cross. Every edge
+ * of a merge is a piece of an input segment, so two pieces of a red and a
+ * blue segment intersect at most at this point. Collinear segments have
+ * no entry. A pair of segments is red and blue at exactly one merge, the
+ * one of the two halves first separating them, so a memo per merge serves
+ * the whole computation.
+ */
+template<class Point_>
+class Intersection_memo
+  {
+  public:
+
+    typedef Point_ Point_2;
+    typedef std::pair<unsigned int, unsigned int> Segment_pair;
+
+  private:
+
+    typedef std::map<Segment_pair, Point_2> Crossing_map;
+
+    Crossing_map m_crossings;
+    std::size_t m_hits;
+
+  public:
+
+    Intersection_memo() :
+      m_hits(0)
+      {
+      }
+
+    /*!
+     * Find the crossing of the red segment red and the blue segment blue.
+     * \return The crossing point, or 0 if it is not memorized.
+     */
+    const Point_2* find(unsigned int red, unsigned int blue)
+      {
+        typename Crossing_map::const_iterator it =
+            m_crossings.find(Segment_pair(red, blue));
+        if (it == m_crossings.end())
+          {
+            return 0;
+          }
+        m_hits++;
+        return &(it->second);
+      }
+
+    /*! Memorize p as the crossing of the red and the blue segment. */
+    void insert(unsigned int red, unsigned int blue, const Point_2& p)
+      {
+        m_crossings.insert(std::make_pair(Segment_pair(red, blue), p));
+      }
+
+    /*! The number of memorized crossings. */
+    std::size_t size() const
+      {
+        return m_crossings.size();
+      }
+
+    /*! The number of crossings found instead of being computed again. */
+    std::size_t hits() const
+      {
+        return m_hits;
+      }
+  };
+
+CGAL_END_NAMESPACE
+
+#endif
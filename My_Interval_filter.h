@@ -0,0 +1,130 @@
+#ifndef MY_INTERVAL_FILTER_H
+#define MY_INTERVAL_FILTER_H
+
+#include <CGAL/basic.h>
+#include <CGAL/Bbox_2.h>
+#include <CGAL/Interval_nt.h>
+#include <utility>
+
+/*! \file
+ * double interval approximation of a curve of the sweep, to reject pairs of
+ * curves that cannot intersect before their exact intersection is computed
+ * by Jannis Warnat
+ */
+
+CGAL_BEGIN_NAMESPACE
+
+/*! \class
+ * The endpoints of a segment as boxes of double intervals, taken from the
+ * approximations of the kernel, and their bounding box. Two segments are
+ * certainly disjoint if their bounding boxes are, or if the endpoints of one
+ * lie strictly on one side of the supporting line of the other for every
+ * choice of points in their boxes. Any other pair is left undecided. The
+ * same boxes bound the y-coordinate of the segment at a given x.
+ */
+class Interval_segment
+  {
+    typedef Interval_nt_advanced IT;
+
+    Bbox_2 m_source;
+    Bbox_2 m_target;
+    Bbox_2 m_bbox;
+
+    /*!
+     * The sign of the orientation of the boxes of source, target and p, or
+     * ZERO if it is not the same for all points in them.
+     */
+    Sign certain_orientation(const Bbox_2& p) const
+      {
+        IT sx(m_source.xmin(), m_source.xmax());
+        IT sy(m_source.ymin(), m_source.ymax());
+        IT tx(m_target.xmin(), m_target.xmax());
+        IT ty(m_target.ymin(), m_target.ymax());
+        IT px(p.xmin(), p.xmax());
+        IT py(p.ymin(), p.ymax());
+
+        IT o = (tx - sx) * (py - sy) - (ty - sy) * (px - sx);
+        if (o.inf() > 0)
+          {
+            return POSITIVE;
+          }
+        if (o.sup() < 0)
+          {
+            return NEGATIVE;
+          }
+        return ZERO;
+      }
+
+    /*! Whether other lies strictly on one side of the line of this. */
+    bool separates(const Interval_segment& other) const
+      {
+        Sign s = certain_orientation(other.m_source);
+        return (s != ZERO && s == certain_orientation(other.m_target));
+      }
+
+  public:
+
+    Interval_segment()
+      {
+      }
+
+    /*! Approximate the segment seg of the kernel. */
+    template<class Segment>
+    void set(const Segment& seg)
+      {
+        m_source = seg.source().bbox();
+        m_target = seg.target().bbox();
+        m_bbox = m_source + m_target;
+      }
+
+    const Bbox_2& bbox() const
+      {
+        return m_bbox;
+      }
+
+    /*!
+     * Bound the y-coordinate of the segment at the x-coordinate in x.
+     * \return false if x is not certainly in the x-range of the segment or
+     * the segment may be vertical; y is undefined then.
+     */
+    bool y_at_x(const std::pair<double, double>& x,
+        std::pair<double, double>& y) const
+      {
+        const Bbox_2* left = &m_source;
+        const Bbox_2* right = &m_target;
+        if (m_target.xmax() < m_source.xmin())
+          {
+            std::swap(left, right);
+          }
+        if (!(left->xmax() < right->xmin() && left->xmax() <= x.first
+            && x.second <= right->xmin()))
+          {
+            return false;
+          }
+
+        Protect_FPU_rounding<true> protection;
+        IT lx(left->xmin(), left->xmax());
+        IT ly(left->ymin(), left->ymax());
+        IT rx(right->xmin(), right->xmax());
+        IT ry(right->ymin(), right->ymax());
+        IT y_at = ly + (IT(x.first, x.second) - lx) * (ry - ly) / (rx - lx);
+        y = std::make_pair(y_at.inf(), y_at.sup());
+        return true;
+      }
+
+    /*! Whether this and other certainly have no point in common. */
+    bool certainly_disjoint(const Interval_segment& other) const
+      {
+        if (!do_overlap(m_bbox, other.m_bbox))
+          {
+            return true;
+          }
+
+        Protect_FPU_rounding<true> protection;
+        return (separates(other) || other.separates(*this));
+      }
+  };
+
+CGAL_END_NAMESPACE
+
+#endif
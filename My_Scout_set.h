@@ -0,0 +1,574 @@
+#ifndef MY_SCOUT_SET_H
+#define MY_SCOUT_SET_H
+
+#include <cstddef>
+#include <iterator>
+
+/*! \file
+ * the ordered set holding the scouts of a sweep: a treap whose nodes keep
+ * summary bits of their subtrees, so that the nearest element below or above
+ * a given one with certain bits is found in logarithmic expected time;
+ * it needs no CGAL header, so that it can be tested on its own
+ * by Jannis Warnat
+ */
+
+namespace CGAL {
+
+/*! \class
+ * A multiset ordered by Compare_, with the insertion and iteration interface
+ * of CGAL::Multiset used for the scouts. Compare_ returns a negative value,
+ * as CGAL::SMALLER, if its first argument is smaller. Summary_ maps a value
+ * to a set of bits; after the bits of a value changed, refresh() has to be
+ * called for its position.
+ */
+template<class Value_, class Compare_, class Summary_>
+class Summarized_multiset
+  {
+  public:
+
+    typedef Value_ Value;
+    typedef Compare_ Compare;
+    typedef Summary_ Summary;
+    typedef std::size_t size_type;
+
+  private:
+
+    struct Node
+      {
+        Value value;
+        Node* left;
+        Node* right;
+        Node* parent;
+        unsigned int priority;
+
+        //the bits of the value and of the whole subtree
+        unsigned int own;
+        unsigned int sum;
+
+        Node(const Value& v, unsigned int p) :
+          value(v), left(0), right(0), parent(0), priority(p), own(0), sum(0)
+          {
+          }
+      };
+
+  public:
+
+    class iterator;
+    friend class iterator;
+
+    /*! A bidirectional iterator; end() has no node. */
+    class iterator
+      {
+        friend class Summarized_multiset;
+
+        Node* m_node;
+        const Summarized_multiset* m_set;
+
+        iterator(Node* n, const Summarized_multiset* s) :
+          m_node(n), m_set(s)
+          {
+          }
+
+      public:
+
+        typedef std::bidirectional_iterator_tag iterator_category;
+        typedef Value value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Value* pointer;
+        typedef Value& reference;
+
+        iterator() :
+          m_node(0), m_set(0)
+          {
+          }
+
+        reference operator*() const
+          {
+            return m_node->value;
+          }
+
+        pointer operator->() const
+          {
+            return &(m_node->value);
+          }
+
+        iterator& operator++()
+          {
+            m_node = Summarized_multiset::_next(m_node);
+            return *this;
+          }
+
+        iterator operator++(int)
+          {
+            iterator tmp = *this;
+            ++(*this);
+            return tmp;
+          }
+
+        iterator& operator--()
+          {
+            m_node = (m_node == 0) ? m_set->_last()
+                : Summarized_multiset::_prev(m_node);
+            return *this;
+          }
+
+        iterator operator--(int)
+          {
+            iterator tmp = *this;
+            --(*this);
+            return tmp;
+          }
+
+        bool operator==(const iterator& it) const
+          {
+            return m_node == it.m_node;
+          }
+
+        bool operator!=(const iterator& it) const
+          {
+            return m_node != it.m_node;
+          }
+      };
+
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+
+  private:
+
+    Node* m_root;
+    size_type m_size;
+    Compare m_comp;
+    Summary m_summary;
+    unsigned int m_seed;
+
+    //not copyable
+    Summarized_multiset(const Summarized_multiset&);
+    Summarized_multiset& operator=(const Summarized_multiset&);
+
+  public:
+
+    Summarized_multiset(const Compare& comp, const Summary& summary = Summary()) :
+      m_root(0), m_size(0), m_comp(comp), m_summary(summary), m_seed(12345)
+      {
+      }
+
+    ~Summarized_multiset()
+      {
+        _destroy(m_root);
+      }
+
+    iterator begin()
+      {
+        return iterator(_first(), this);
+      }
+
+    iterator end()
+      {
+        return iterator(0, this);
+      }
+
+    reverse_iterator rbegin()
+      {
+        return reverse_iterator(end());
+      }
+
+    reverse_iterator rend()
+      {
+        return reverse_iterator(begin());
+      }
+
+    size_type size() const
+      {
+        return m_size;
+      }
+
+    bool empty() const
+      {
+        return m_size == 0;
+      }
+
+    /*! Insert v after all values not larger than v. */
+    iterator insert(const Value& v)
+      {
+        Node* n = new Node(v, _priority());
+
+        if (m_root == 0)
+          {
+            m_root = n;
+          }
+        else
+          {
+            Node* curr = m_root;
+            while (true)
+              {
+                if (m_comp(v, curr->value) < 0)
+                  {
+                    if (curr->left == 0)
+                      {
+                        curr->left = n;
+                        break;
+                      }
+                    curr = curr->left;
+                  }
+                else
+                  {
+                    if (curr->right == 0)
+                      {
+                        curr->right = n;
+                        break;
+                      }
+                    curr = curr->right;
+                  }
+              }
+            n->parent = curr;
+          }
+
+        _link(n);
+        return iterator(n, this);
+      }
+
+    /*! Insert v right before pos, without comparisons. */
+    iterator insert_before(iterator pos, const Value& v)
+      {
+        Node* n = new Node(v, _priority());
+
+        if (pos.m_node == 0)
+          {
+            Node* last = _last();
+            if (last == 0)
+              {
+                m_root = n;
+              }
+            else
+              {
+                last->right = n;
+                n->parent = last;
+              }
+          }
+        else if (pos.m_node->left == 0)
+          {
+            pos.m_node->left = n;
+            n->parent = pos.m_node;
+          }
+        else
+          {
+            Node* pred = _rightmost(pos.m_node->left);
+            pred->right = n;
+            n->parent = pred;
+          }
+
+        _link(n);
+        return iterator(n, this);
+      }
+
+    void erase(iterator pos)
+      {
+        Node* n = pos.m_node;
+
+        //rotate n down until it has one child at most
+        while (n->left != 0 && n->right != 0)
+          {
+            _rotate_up((n->left->priority > n->right->priority) ? n->left
+                : n->right);
+          }
+
+        Node* child = (n->left != 0) ? n->left : n->right;
+        Node* p = n->parent;
+        if (child != 0)
+          {
+            child->parent = p;
+          }
+        if (p == 0)
+          {
+            m_root = child;
+          }
+        else if (p->left == n)
+          {
+            p->left = child;
+          }
+        else
+          {
+            p->right = child;
+          }
+
+        _update_path(p);
+        delete n;
+        m_size--;
+      }
+
+    /*! Recompute the bits of the value at pos. */
+    void refresh(iterator pos)
+      {
+        pos.m_node->own = m_summary(pos.m_node->value);
+        _update_path(pos.m_node);
+      }
+
+    /*! The nearest value before pos sharing a bit with mask, or end(). */
+    iterator find_prev(iterator pos, unsigned int mask)
+      {
+        Node* n = pos.m_node;
+        if (n == 0)
+          {
+            if (m_root != 0 && (m_root->sum & mask))
+              {
+                return iterator(_rightmost_with(m_root, mask), this);
+              }
+            return end();
+          }
+
+        if (n->left != 0 && (n->left->sum & mask))
+          {
+            return iterator(_rightmost_with(n->left, mask), this);
+          }
+
+        while (n->parent != 0)
+          {
+            Node* p = n->parent;
+            if (p->right == n)
+              {
+                if (p->own & mask)
+                  {
+                    return iterator(p, this);
+                  }
+                if (p->left != 0 && (p->left->sum & mask))
+                  {
+                    return iterator(_rightmost_with(p->left, mask), this);
+                  }
+              }
+            n = p;
+          }
+        return end();
+      }
+
+    /*! The nearest value after pos sharing a bit with mask, or end(). */
+    iterator find_next(iterator pos, unsigned int mask)
+      {
+        Node* n = pos.m_node;
+        if (n == 0)
+          {
+            return end();
+          }
+
+        if (n->right != 0 && (n->right->sum & mask))
+          {
+            return iterator(_leftmost_with(n->right, mask), this);
+          }
+
+        while (n->parent != 0)
+          {
+            Node* p = n->parent;
+            if (p->left == n)
+              {
+                if (p->own & mask)
+                  {
+                    return iterator(p, this);
+                  }
+                if (p->right != 0 && (p->right->sum & mask))
+                  {
+                    return iterator(_leftmost_with(p->right, mask), this);
+                  }
+              }
+            n = p;
+          }
+        return end();
+      }
+
+  private:
+
+    unsigned int _priority()
+      {
+        m_seed = m_seed * 1103515245u + 12345u;
+        return m_seed >> 4;
+      }
+
+    // a new leaf n is in place: set its bits, account for them on the path
+    // to the root and restore the heap order of the priorities
+    void _link(Node* n)
+      {
+        m_size++;
+        n->own = m_summary(n->value);
+        n->sum = n->own;
+        _update_path(n->parent);
+
+        while (n->parent != 0 && n->priority > n->parent->priority)
+          {
+            _rotate_up(n);
+          }
+      }
+
+    // rotate x above its parent; the subtrees of all other nodes stay as
+    // they are
+    void _rotate_up(Node* x)
+      {
+        Node* p = x->parent;
+        Node* g = p->parent;
+
+        if (p->left == x)
+          {
+            p->left = x->right;
+            if (x->right != 0)
+              {
+                x->right->parent = p;
+              }
+            x->right = p;
+          }
+        else
+          {
+            p->right = x->left;
+            if (x->left != 0)
+              {
+                x->left->parent = p;
+              }
+            x->left = p;
+          }
+
+        p->parent = x;
+        x->parent = g;
+        if (g == 0)
+          {
+            m_root = x;
+          }
+        else if (g->left == p)
+          {
+            g->left = x;
+          }
+        else
+          {
+            g->right = x;
+          }
+
+        _pull(p);
+        _pull(x);
+      }
+
+    static void _pull(Node* n)
+      {
+        n->sum = n->own;
+        if (n->left != 0)
+          {
+            n->sum |= n->left->sum;
+          }
+        if (n->right != 0)
+          {
+            n->sum |= n->right->sum;
+          }
+      }
+
+    static void _update_path(Node* n)
+      {
+        while (n != 0)
+          {
+            _pull(n);
+            n = n->parent;
+          }
+      }
+
+    static Node* _leftmost(Node* n)
+      {
+        while (n->left != 0)
+          {
+            n = n->left;
+          }
+        return n;
+      }
+
+    static Node* _rightmost(Node* n)
+      {
+        while (n->right != 0)
+          {
+            n = n->right;
+          }
+        return n;
+      }
+
+    // the first node of the subtree n sharing a bit with mask; the subtree
+    // must contain one
+    static Node* _leftmost_with(Node* n, unsigned int mask)
+      {
+        while (true)
+          {
+            if (n->left != 0 && (n->left->sum & mask))
+              {
+                n = n->left;
+              }
+            else if (n->own & mask)
+              {
+                return n;
+              }
+            else
+              {
+                n = n->right;
+              }
+          }
+      }
+
+    // the last node of the subtree n sharing a bit with mask; the subtree
+    // must contain one
+    static Node* _rightmost_with(Node* n, unsigned int mask)
+      {
+        while (true)
+          {
+            if (n->right != 0 && (n->right->sum & mask))
+              {
+                n = n->right;
+              }
+            else if (n->own & mask)
+              {
+                return n;
+              }
+            else
+              {
+                n = n->left;
+              }
+          }
+      }
+
+    static Node* _next(Node* n)
+      {
+        if (n->right != 0)
+          {
+            return _leftmost(n->right);
+          }
+        while (n->parent != 0 && n->parent->right == n)
+          {
+            n = n->parent;
+          }
+        return n->parent;
+      }
+
+    static Node* _prev(Node* n)
+      {
+        if (n->left != 0)
+          {
+            return _rightmost(n->left);
+          }
+        while (n->parent != 0 && n->parent->left == n)
+          {
+            n = n->parent;
+          }
+        return n->parent;
+      }
+
+    Node* _first() const
+      {
+        return (m_root == 0) ? 0 : _leftmost(m_root);
+      }
+
+    Node* _last() const
+      {
+        return (m_root == 0) ? 0 : _rightmost(m_root);
+      }
+
+    static void _destroy(Node* n)
+      {
+        if (n != 0)
+          {
+            _destroy(n->left);
+            _destroy(n->right);
+            delete n;
+          }
+      }
+  };
+
+} //namespace CGAL
+
+#endif
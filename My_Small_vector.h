@@ -0,0 +1,193 @@
+#ifndef MY_SMALL_VECTOR_H
+#define MY_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+/*! \file
+ * a vector of pointers that keeps its first elements inside the object and
+ * only goes to the heap when it grows beyond them; used for the subcurves
+ * incident to an event, which are one or two per list almost always;
+ * it needs no CGAL header, so that it can be tested on its own
+ * by Jannis Warnat
+ */
+
+namespace CGAL {
+
+/*! \class
+ * A vector of trivially copyable values with inline capacity N. Unlike the
+ * std::list it replaces, insert() and push_back() invalidate all iterators;
+ * insert() returns an iterator to the inserted value instead.
+ */
+template<class T, std::size_t N>
+class Small_vector
+  {
+  public:
+
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef std::size_t size_type;
+
+  private:
+
+    T* m_data;
+    size_type m_size;
+    size_type m_capacity;
+    T m_inline[N];
+
+  public:
+
+    Small_vector() :
+      m_data(m_inline), m_size(0), m_capacity(N)
+      {
+      }
+
+    Small_vector(const Small_vector& v) :
+      m_data(m_inline), m_size(0), m_capacity(N)
+      {
+        _assign(v);
+      }
+
+    Small_vector& operator=(const Small_vector& v)
+      {
+        if (this != &v)
+          {
+            m_size = 0;
+            _assign(v);
+          }
+        return *this;
+      }
+
+    ~Small_vector()
+      {
+        if (m_data != m_inline)
+          {
+            delete[] m_data;
+          }
+      }
+
+    iterator begin()
+      {
+        return m_data;
+      }
+
+    iterator end()
+      {
+        return m_data + m_size;
+      }
+
+    const_iterator begin() const
+      {
+        return m_data;
+      }
+
+    const_iterator end() const
+      {
+        return m_data + m_size;
+      }
+
+    reverse_iterator rbegin()
+      {
+        return reverse_iterator(end());
+      }
+
+    reverse_iterator rend()
+      {
+        return reverse_iterator(begin());
+      }
+
+    size_type size() const
+      {
+        return m_size;
+      }
+
+    bool empty() const
+      {
+        return m_size == 0;
+      }
+
+    reference front()
+      {
+        return m_data[0];
+      }
+
+    const_reference front() const
+      {
+        return m_data[0];
+      }
+
+    void push_back(const T& t)
+      {
+        if (m_size == m_capacity)
+          {
+            _grow();
+          }
+        m_data[m_size++] = t;
+      }
+
+    /*! Insert t before pos; returns the position of t. */
+    iterator insert(iterator pos, const T& t)
+      {
+        size_type i = pos - m_data;
+        if (m_size == m_capacity)
+          {
+            _grow();
+          }
+        std::copy_backward(m_data + i, m_data + m_size, m_data + m_size + 1);
+        m_data[i] = t;
+        m_size++;
+        return m_data + i;
+      }
+
+    iterator erase(iterator pos)
+      {
+        return erase(pos, pos + 1);
+      }
+
+    iterator erase(iterator first, iterator last)
+      {
+        std::copy(last, end(), first);
+        m_size -= last - first;
+        return first;
+      }
+
+    void clear()
+      {
+        m_size = 0;
+      }
+
+  private:
+
+    // double the capacity, moving the values to the heap
+    void _grow()
+      {
+        T* data = new T[2 * m_capacity];
+        std::copy(m_data, m_data + m_size, data);
+        if (m_data != m_inline)
+          {
+            delete[] m_data;
+          }
+        m_data = data;
+        m_capacity *= 2;
+      }
+
+    void _assign(const Small_vector& v)
+      {
+        while (m_capacity < v.m_size)
+          {
+            _grow();
+          }
+        std::copy(v.begin(), v.end(), m_data);
+        m_size = v.m_size;
+      }
+  };
+
+} //namespace CGAL
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef MY_SWEEP_ARENA_H
+#define MY_SWEEP_ARENA_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/*! \file
+ * a per-sweep arena for the events, scouts and overlap subcurves: objects
+ * are placed one after the other in blocks and released together when the
+ * sweep is complete; it needs no CGAL header, so that it can be tested on
+ * its own
+ * by Jannis Warnat
+ */
+
+namespace CGAL {
+
+/*! \class
+ * Hands out storage for objects of type T from blocks of block_size objects.
+ * Every allocate() must be followed by the construction of a T in the storage
+ * returned; clear() destroys all of them in the order of their allocation.
+ */
+template<class T>
+class Sweep_arena
+  {
+    std::vector<T*> m_blocks;
+    std::size_t m_block_size;
+
+    //the number of objects in the last block
+    std::size_t m_used;
+
+    //not copyable
+    Sweep_arena(const Sweep_arena&);
+    Sweep_arena& operator=(const Sweep_arena&);
+
+  public:
+
+    explicit Sweep_arena(std::size_t block_size = 256) :
+      m_block_size(block_size), m_used(block_size)
+      {
+      }
+
+    ~Sweep_arena()
+      {
+        clear();
+      }
+
+    /*! Storage for one object, to be constructed by placement new. */
+    void* allocate()
+      {
+        if (m_used == m_block_size)
+          {
+            m_blocks.push_back(static_cast<T*>(::operator new(m_block_size
+                * sizeof(T))));
+            m_used = 0;
+          }
+        return m_blocks.back() + m_used++;
+      }
+
+    /*! A copy of t in the arena. */
+    T* construct(const T& t)
+      {
+        return new (allocate()) T(t);
+      }
+
+    /*! Destroy all objects and release the blocks. */
+    void clear()
+      {
+        for (std::size_t b = 0; b < m_blocks.size(); b++)
+          {
+            std::size_t n = (b + 1 == m_blocks.size()) ? m_used : m_block_size;
+            for (std::size_t i = 0; i < n; i++)
+              {
+                m_blocks[b][i].~T();
+              }
+            ::operator delete(m_blocks[b]);
+          }
+        m_blocks.clear();
+        m_used = m_block_size;
+      }
+  };
+
+} //namespace CGAL
+
+#endif
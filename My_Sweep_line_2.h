@@ -25,6 +25,7 @@
  * Definition of the Sweep_line_2 class.
  */
 #include "My_Basic_sweep_line_2.h"
+#include "My_Curve_pair_table.h"
 
 CGAL_BEGIN_NAMESPACE
 
@@ -44,6 +45,8 @@ CGAL_BEGIN_NAMESPACE
 
  General flow:
  After the initialization stage, the events are handled from left to right.
+ If the meta traits wrap Arr_mirrored_traits_2, left and right are those of
+ the input rotated by 180 degrees, i.e. the sweep runs from right to left.
 
  For each event
 
@@ -96,6 +99,7 @@ Allocator_>
     typedef typename Arrangement_2::Halfedge_handle Halfedge_handle;
     typedef typename Base::My_Scout My_Scout;
 
+    typedef typename Traits_2::Traits_2 Base_traits_2;
     typedef typename Base::Traits_adaptor_2 Traits_adaptor_2;
     typedef typename Traits_adaptor_2::Point_2 Point_2;
     typedef typename Traits_adaptor_2::X_monotone_curve_2 X_monotone_curve_2;
@@ -112,12 +116,7 @@ Allocator_>
     typedef typename Base::Scout_set Scout_set;
     typedef typename Base::Scout_set_iterator Scout_set_iterator;
 
-    typedef CGAL::Curve_pair<Subcurve> Curve_pair;
-    typedef CGAL::Curve_pair_hasher<Subcurve> Curve_pair_hasher;
-    typedef CGAL::Equal_curve_pair<Subcurve> Equal_curve_pair;
-    typedef Open_hash<Curve_pair,
-    Curve_pair_hasher,
-    Equal_curve_pair> Curve_pair_set;
+    typedef Curve_pair_table<Subcurve> Curve_pair_set;
 
     typedef random_access_input_iterator<std::vector<Object> >
     vector_inserter;
@@ -132,6 +131,9 @@ Allocator_>
     std::vector<Object> m_x_objects; // Auxiliary vector for storing the
     // intersection objects.
 
+    std::size_t m_filtered_pairs; // Pairs found disjoint by their intervals.
+    std::size_t m_intersected_pairs; // Pairs passed to intersect_2.
+
     X_monotone_curve_2 sub_cv1; // Auxiliary varibales
     X_monotone_curve_2 sub_cv2; // (for splitting curves).
 
@@ -141,8 +143,9 @@ Allocator_>
      * Constructor.
      * \param visitor A pointer to a sweep-line visitor object.
      */
-    My_Sweep_line_2 (/*Visitor *visitor*/):
-    m_curves_pair_set(0)
+    My_Sweep_line_2 (/*Visitor *visitor*/) :
+      m_filtered_pairs (0),
+      m_intersected_pairs (0)
       {
       }
 
@@ -151,8 +154,9 @@ Allocator_>
      * \param traits A pointer to a sweep-line traits object.
      * \param visitor A pointer to a sweep-line visitor object.
      */
-    My_Sweep_line_2 (Traits_2 *traits/*, Visitor *visitor*/):
-    m_curves_pair_set(0)
+    My_Sweep_line_2 (Traits_2 *traits/*, Visitor *visitor*/) :
+      m_filtered_pairs (0),
+      m_intersected_pairs (0)
       {
       }
 
@@ -161,6 +165,24 @@ Allocator_>
       {
       }
 
+    /*! The number of curve pairs rejected by the interval filter. */
+    std::size_t filtered_pairs () const
+      {
+        return (m_filtered_pairs);
+      }
+
+    /*! The number of curve pairs whose intersection was computed. */
+    std::size_t intersected_pairs () const
+      {
+        return (m_intersected_pairs);
+      }
+
+    /*! The number of times the pair table outgrew its reserved size. */
+    std::size_t pair_table_grows () const
+      {
+        return (m_curves_pair_set.grows());
+      }
+
   public:
 
     /*! Initialize the data structures for the sweep-line algorithm. */
@@ -169,13 +191,16 @@ Allocator_>
     /*! Complete the sweep process (complete the data structures). */
     virtual void _complete_sweep ();
 
+    /*! Handle the current event, one color after the other. */
+    virtual void _handle_event ();
+
     /*! Handle the subcurves to the left of the current event point. */
-    virtual void _handle_red_left_curves ();
-    virtual void _handle_blue_left_curves();
+    template<class Color>
+    void _handle_left_curves (Color);
 
     /*! Handle the subcurves to the right of the current event point. */
-    virtual void _handle_red_right_curves ();
-    virtual void _handle_blue_right_curves ();
+    template<class Color>
+    void _handle_right_curves (Color);
 
     /*!
      * Add a subcurve to the right of an event point.
@@ -184,13 +209,24 @@ Allocator_>
      * \return (true) if an overlap occured; (false) otherwise.
      */
     virtual bool _add_red_curve_to_right (Event* event, Subcurve* curve,
-        bool overlap_exist = false);
+        bool overlap_exist = false)
+      {
+        return _add_curve_to_right(event, curve, overlap_exist, Red_tag());
+      }
+
     virtual bool _add_blue_curve_to_right (Event* event, Subcurve* curve,
-        bool overlap_exist = false);
+        bool overlap_exist = false)
+      {
+        return _add_curve_to_right(event, curve, overlap_exist, Blue_tag());
+      }
+
+    template<class Color>
+    bool _add_curve_to_right (Event* event, Subcurve* curve,
+        bool overlap_exist, Color);
 
     /*! Fix overlapping subcurves before handling the current event. */
-    void _fix_overlap_subcurves_from_red();
-    void _fix_overlap_subcurves_from_blue();
+    template<class Color>
+    void _fix_overlap_subcurves(Color);
 
     /*!
      * Handle overlap at right insertion to event.
@@ -199,21 +235,20 @@ Allocator_>
      * \param iter An iterator for the curves.
      * \param overlap_exist
      */
-    void _handle_overlap_from_red (Event* event, Subcurve* curve,
-        Event_subcurve_iterator iter, bool overlap_exist);
-    void _handle_overlap_from_blue (Event* event, Subcurve* curve,
-        Event_subcurve_iterator iter, bool overlap_exist);
+    template<class Color>
+    void _handle_overlap (Event* event, Subcurve* curve,
+        Event_subcurve_iterator iter, bool overlap_exist, Color);
 
     /*!
      * Compute intersections between the two given curves.
      * If the two curves intersect, create a new event (or use the event that
      * already exits in the intersection point) and insert the curves to the
      * event.
-     * \param curve1 The first curve.
+     * \param curve1 The first curve, of the color of the tag.
      * \param curve2 The second curve.
      */
-    void _intersect_from_red (Subcurve *c1, Subcurve *c2);
-    void _intersect_from_blue (Subcurve *c1, Subcurve *c2);
+    template<class Color>
+    void _intersect (Subcurve *c1, Subcurve *c2, Color);
 
     /*!
      * When a curve is removed from the status line for good, its top and
@@ -222,30 +257,25 @@ Allocator_>
      * \param leftCurve A pointer to the curve that is about to be deleted.
      * \param remove_for_good Whether the aubcurve is removed for good.
      */
-    void _remove_curve_from_red_status_line (Subcurve *leftCurve,
-        bool remove_for_good);
-    void _remove_curve_from_blue_status_line (Subcurve *leftCurve,
-        bool remove_for_good);
+    template<class Color>
+    void _remove_curve_from_status_line (Subcurve *leftCurve,
+        bool remove_for_good, Color);
 
     /*!
      * Create an intersection-point event between two curves.
      * \param xp The intersection point.
      * \param mult Its multiplicity.
-     * \param curve1 The first curve.
+     * \param curve1 The first curve, of the color of the tag.
      * \param curve2 The second curve.
      * \param is_overlap Whether the two curves overlap at xp.
      */
-    void _create_intersection_point_from_red (Point_2 xp,
-        unsigned int mult,
-        Subcurve* c1,
-        Subcurve* c2,
-        bool is_overlap = false);
-
-    void _create_intersection_point_from_blue (Point_2 xp,
+    template<class Color>
+    void _create_intersection_point (Point_2 xp,
         unsigned int mult,
         Subcurve* c1,
         Subcurve* c2,
-        bool is_overlap = false);
+        bool is_overlap,
+        Color);
 
     /*!
      * Fix a subcurve that represents an overlap.
@@ -255,28 +285,48 @@ Allocator_>
 
     //functions by Jannis Warnat defined and commented
     // in My_Sweep_line_handler.h
-    virtual void prepare_red_blue_intersection();
-    virtual void prepare_red_blue_vertical();
-    virtual void proceed_according_to_vertex_type();
-    void handle_right_endpoint();
-    void handle_left_endpoint();
-    bool is_in_face_x();
-    void start_region();
-    void handle_point_x();
+    // the functions templated on a color tag handle an event of that color,
+    // proceed_according_to_vertex_type() dispatches to them once per event
+    void prepare_red_blue_intersection();
+    void prepare_red_blue_vertical();
+    void proceed_according_to_vertex_type();
+    template<class Color>
+    void proceed_according_to_vertex_type(Color);
+    void set_current_vertex(Red_tag);
+    void set_current_vertex(Blue_tag);
+    template<class Color>
+    void handle_right_endpoint(Color);
+    template<class Color>
+    void handle_left_endpoint(Color);
+    bool is_in_face_x(Red_tag);
+    bool is_in_face_x(Blue_tag);
+    template<class Color>
+    void start_region(Color);
+    template<class Color>
+    void handle_point_x(Color);
     void handle_red_blue_intersection();
     void scout_swap(Subcurve* blue_right, Subcurve* red_right, My_Scout* sc);
-    void handle_default();
-    void inform_guard_above();
-    void inform_guard_below();
+    template<class Color>
+    void handle_default(Color);
+    template<class Color>
+    void inform_guard_above(Color);
+    template<class Color>
+    void inform_guard_below(Color);
     void end_region(My_Scout* lower, My_Scout* upper);
     void end_lower_region(My_Scout* lower, My_Scout* upper);
     void vertical_and_non_vertical(Subcurve* vertical, Subcurve* non_vertical_left, Subcurve* non_vertical_right);
-    void change_assignment_of_lower_guard(Subcurve* left);
-    void change_assignment_of_upper_guard(Subcurve* left);
-    void change_boundary_of_lower_scout(Subcurve* left);
-    void change_boundary_of_upper_scout(Subcurve* left);
-    My_Scout* start_lower_scout();
-    My_Scout* start_upper_scout(Scout_set_iterator lower);
+    template<class Color>
+    void change_assignment_of_lower_guard(Subcurve* left, Color);
+    template<class Color>
+    void change_assignment_of_upper_guard(Subcurve* left, Color);
+    template<class Color>
+    void change_boundary_of_lower_scout(Subcurve* left, Color);
+    template<class Color>
+    void change_boundary_of_upper_scout(Subcurve* left, Color);
+    template<class Color>
+    My_Scout* start_lower_scout(Color);
+    template<class Color>
+    My_Scout* start_upper_scout(Scout_set_iterator lower, Color);
   };
 
 CGAL_END_NAMESPACE
@@ -202,14 +202,14 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 //                      }
                     CGAL_assertion((*ssi)->guarded_curve() == curve_below
                         || this->current_event_point.base().x()
-                            == curve_below->last_curve().base().left().x());
+                            == curve_below->left_event()->point().base().x());
                   }
                 else
                   {
                     CGAL_assertion(
                         (*ssi)->guarded_curve() == curve_below
                             || this->current_event_point.base().x()
-                                == (*ssi)->guarded_curve()->last_curve().base().right().x());
+                                == (*ssi)->guarded_curve()->right_event()->point().base().x());
                   }
               }
           }
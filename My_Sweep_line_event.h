@@ -23,12 +23,31 @@
 #ifndef MY_CGAL_SWEEP_LINE_EVENT_H
 #define MY_CGAL_SWEEP_LINE_EVENT_H
 
+#include "My_Small_vector.h"
+
 /*! \file
  * Defintion of the Sweep_line_event class.
  */
 
 CGAL_BEGIN_NAMESPACE
 
+// by Jannis Warnat
+// tags for the two colors of curves swept at the same time; index selects
+// the red or blue one of two containers, Other is the other color
+struct Blue_tag;
+
+struct Red_tag
+{
+  enum { index = 0 };
+  typedef Blue_tag Other;
+};
+
+struct Blue_tag
+{
+  enum { index = 1 };
+  typedef Red_tag Other;
+};
+
 /*! \class Sweep_line_event
  *
  * A class associated with an event in a sweep line algorithm.
@@ -58,7 +77,10 @@ public:
   typedef Subcurve_                                     Subcurve;
   //template<typename SC>
   //struct SC_container { typedef std::list<SC> other; };
-  typedef std::list<Subcurve*>                          Subcurve_container;
+  // by Jannis Warnat
+  // almost every event has one or two curves per list, so they are kept
+  // inside the event; insertions invalidate the iterators of a list
+  typedef Small_vector<Subcurve*, 2>                    Subcurve_container;
   typedef typename Subcurve_container::iterator         Subcurve_iterator;
   typedef typename Subcurve_container::reverse_iterator
                                                 Subcurve_reverse_iterator;
@@ -82,14 +104,14 @@ protected:
   // Data members:
   Point_2            m_point;       // The point associated with the event.
 
-  Subcurve_container m_red_leftCurves;
-  Subcurve_container m_blue_leftCurves;// The curves lying to the left of the
-                                    // event and incident to it.
+  Subcurve_container m_leftCurves[2];  // The red and the blue curves lying
+                                    // to the left of the event and incident
+                                    // to it.
 
-  Subcurve_container m_red_rightCurves;
-  Subcurve_container m_blue_rightCurves;// The curves lying to the right of the
-                                    // event and incident to it, sorted by
-                                    // their y-value to the right of the point.
+  Subcurve_container m_rightCurves[2]; // The red and the blue curves lying
+                                    // to the right of the event and incident
+                                    // to it, sorted by their y-value to the
+                                    // right of the point.
 
   char               m_type;        // The event type.
   char               m_ps_x;        // The boundary condition in x.
@@ -99,6 +121,11 @@ protected:
 
   bool u_comp_y_at_x_left;
 
+  unsigned int m_x_index;           // The index of the x-coordinate of the
+                                    // event among those of the sweep, set
+                                    // when it becomes the current event;
+                                    // 0 before.
+
 public:
 
   /*! Default constructor. */
@@ -107,9 +134,23 @@ public:
     m_ps_x (static_cast<char> (ARR_INTERIOR)),
     m_ps_y (static_cast<char> (ARR_INTERIOR)),
     m_finite (1),
-    u_comp_y_at_x_left(false)
+    u_comp_y_at_x_left(false),
+    m_x_index (0)
   {}
 
+  // by Jannis Warnat
+  // events with the same x-coordinate share the index, so the subcurves
+  // can cache their y-value at the x of the current event by it
+  void set_x_index(unsigned int i)
+  {
+    m_x_index = i;
+  }
+
+  unsigned int x_index() const
+  {
+    return m_x_index;
+  }
+
   // by Jannis Warnat
   // normally we have to compare the curves to the right of the current
   // event points; if we want to compare to the left, we have to set this
@@ -144,38 +185,20 @@ public:
     m_finite = 0;
   }
 
-  /*! Add a subcurve to the container of left curves. */
-  void add_red_curve_to_left (Subcurve *curve)
-  {
-    // Look for the subcurve.
-    Subcurve_iterator iter;
-
-    for (iter = m_red_leftCurves.begin(); iter != m_red_leftCurves.end(); ++iter)
-    {
-      // Do nothing if the curve exists.
-      if ((curve == *iter) || (*iter)->is_inner_node(curve))
-        return;
-
-      // Replace the existing curve in case of overlap.
-      if (curve->is_inner_node(*iter))
-      {
-        *iter = curve;
-        return;
-      }
-    }
-
-    // The curve does not exist - insert it to the container.
-    m_red_leftCurves.push_back (curve);
-    return;
-  }
+  // by Jannis Warnat
+  // the functions below take the color of the curves as a tag, so the red
+  // and the blue containers share one implementation
 
   /*! Add a subcurve to the container of left curves. */
-  void add_blue_curve_to_left (Subcurve *curve)
+  template<class Color>
+  void add_curve_to_left (Subcurve *curve, Color)
   {
+    Subcurve_container& left_curves = m_leftCurves[Color::index];
+
     // Look for the subcurve.
     Subcurve_iterator iter;
 
-    for (iter = m_blue_leftCurves.begin(); iter != m_blue_leftCurves.end(); ++iter)
+    for (iter = left_curves.begin(); iter != left_curves.end(); ++iter)
     {
       // Do nothing if the curve exists.
       if ((curve == *iter) || (*iter)->is_inner_node(curve))
@@ -190,78 +213,36 @@ public:
     }
 
     // The curve does not exist - insert it to the container.
-    m_blue_leftCurves.push_back (curve);
+    left_curves.push_back (curve);
     return;
   }
 
   /*! Add a subcurve to the container of left curves (without checks). */
-  void push_back_red_curve_to_left(Subcurve *curve)
+  template<class Color>
+  void push_back_curve_to_left (Subcurve *curve, Color)
   {
-    m_red_leftCurves.push_back(curve);
-  }
-
-  /*! Add a subcurve to the container of left curves (without checks). */
-  void push_back_blue_curve_to_left(Subcurve *curve)
-  {
-    m_blue_leftCurves.push_back(curve);
+    m_leftCurves[Color::index].push_back(curve);
   }
 
   /*! Add a subcurve to the container of right curves. */
+  template<class Color>
   std::pair<bool, Subcurve_iterator>
-  add_red_curve_to_right (Subcurve *curve, Traits_2 *tr)
+  add_curve_to_right (Subcurve *curve, Traits_2 *tr, Color)
   {
-    if (m_red_rightCurves.empty())
-    {
-      m_red_rightCurves.push_back(curve);
-      return (std::make_pair(false, m_red_rightCurves.begin()));
-    }
-
-    // Check if its an event an infinity, and if so then there is no overlap
-    //(there cannot be two non-overlap curves at the same event at infinity).
-    if (!this->is_finite())
-      return (std::make_pair(true, m_red_rightCurves.begin()));
-
-    Subcurve_iterator iter = m_red_rightCurves.begin();
-    Comparison_result res;
-
-    while ((res = tr->compare_y_at_x_right_2_object()
-            (curve->last_curve(),
-             (*iter)->last_curve(),
-             m_point)) == LARGER)
-    {
-      ++iter;
-      if (iter == m_red_rightCurves.end())
-      {
-        m_red_rightCurves.insert (iter, curve);
-        return std::make_pair (false, --iter);
-      }
-    }
-
-    if (res == EQUAL) //overlap !!
-    {
-      return std::make_pair(true, iter);
-    }
-
-    m_red_rightCurves.insert (iter, curve);
-    return std::make_pair (false,--iter);
-  }
+    Subcurve_container& right_curves = m_rightCurves[Color::index];
 
-  /*! Add a subcurve to the container of right curves. */
-  std::pair<bool, Subcurve_iterator>
-  add_blue_curve_to_right (Subcurve *curve, Traits_2 *tr)
-  {
-    if (m_blue_rightCurves.empty())
+    if (right_curves.empty())
     {
-      m_blue_rightCurves.push_back(curve);
-      return (std::make_pair(false, m_blue_rightCurves.begin()));
+      right_curves.push_back(curve);
+      return (std::make_pair(false, right_curves.begin()));
     }
 
     // Check if its an event an infinity, and if so then there is no overlap
     //(there cannot be two non-overlap curves at the same event at infinity).
     if (!this->is_finite())
-      return (std::make_pair(true, m_blue_rightCurves.begin()));
+      return (std::make_pair(true, right_curves.begin()));
 
-    Subcurve_iterator iter = m_blue_rightCurves.begin();
+    Subcurve_iterator iter = right_curves.begin();
     Comparison_result res;
 
     while ((res = tr->compare_y_at_x_right_2_object()
@@ -270,10 +251,10 @@ public:
              m_point)) == LARGER)
     {
       ++iter;
-      if (iter == m_blue_rightCurves.end())
+      if (iter == right_curves.end())
       {
-        m_blue_rightCurves.insert (iter, curve);
-        return std::make_pair (false, --iter);
+        iter = right_curves.insert (iter, curve);
+        return std::make_pair (false, iter);
       }
     }
 
@@ -282,279 +263,106 @@ public:
       return std::make_pair(true, iter);
     }
 
-    m_blue_rightCurves.insert (iter, curve);
-    return std::make_pair (false,--iter);
+    iter = right_curves.insert (iter, curve);
+    return std::make_pair (false, iter);
   }
 
-//  /*!
-//   * Add two Subcurves to the right of the event.
-//   * \pre The event does not contain any right curves, and the order of sc1
-//   *      and sc2 is correct.
-//   */
-//  std::pair<bool, Subcurve_iterator>
-//  add_curve_pair_to_right (Subcurve *sc1, Subcurve *sc2)
-//  {
-//    m_red_rightCurves.push_back(sc1);
-//    m_red_rightCurves.push_back(sc2);
-//
-//    Subcurve_iterator iter = m_red_rightCurves.end();
-//    --iter;
-//    return (std::make_pair (false, iter));
-//  }
-
-    /*!
-     * Add two Subcurves to the right of the event.
-     * \pre The event does not contain any right curves, and the order of sc1
-     *      and sc2 is correct.
-     */
-    //std::pair<bool, Subcurve_iterator>
-    void add_curve_pair_to_right_from_red (Subcurve *sc1, Subcurve *sc2)
-    {
-      m_red_rightCurves.push_back(sc1);
-      m_blue_rightCurves.push_back(sc2);
-
-      //Subcurve_iterator iter = m_red_rightCurves.end();
-      //--iter;
-      //return (std::make_pair (false, iter));
-    }
-
-    void add_curve_pair_to_right_from_blue (Subcurve *sc1, Subcurve *sc2)
-    {
-      m_blue_rightCurves.push_back(sc1);
-      m_red_rightCurves.push_back(sc2);
-
-      //Subcurve_iterator iter = m_red_rightCurves.end();
-      //--iter;
-      //return (std::make_pair (false, iter));
-    }
-
-
-
-  /*! Remove a curve from the set of left curves. */
-  void remove_red_curve_from_left (Subcurve* curve)
-  {
-    Subcurve_iterator iter;
-
-    for (iter = m_red_leftCurves.begin(); iter!= m_red_leftCurves.end(); ++iter)
-    {
-      if(curve->has_common_leaf (*iter))
-      {
-        m_red_leftCurves.erase(iter);
-        return;
-      }
-    }
-    return;
-  }
-
-  void remove_blue_curve_from_left (Subcurve* curve)
+  /*!
+   * Add two Subcurves to the right of the event, sc1 of the given color and
+   * sc2 of the other one.
+   * \pre The event does not contain any right curves.
+   */
+  template<class Color>
+  void add_curve_pair_to_right (Subcurve *sc1, Subcurve *sc2, Color)
   {
-    Subcurve_iterator iter;
-
-    for (iter = m_blue_leftCurves.begin(); iter!= m_blue_leftCurves.end(); ++iter)
-    {
-      if(curve->has_common_leaf (*iter))
-      {
-        m_blue_leftCurves.erase(iter);
-        return;
-      }
-    }
-    return;
+    m_rightCurves[Color::index].push_back(sc1);
+    m_rightCurves[Color::Other::index].push_back(sc2);
   }
 
-  void remove_red_curve_from_right (Subcurve* curve)
+  /*! Remove a curve from the set of left curves. */
+  template<class Color>
+  void remove_curve_from_left (Subcurve* curve, Color)
   {
-    Subcurve_iterator iter;
-
-    for (iter = m_red_rightCurves.begin(); iter!= m_red_rightCurves.end(); ++iter)
-    {
-      if(curve->has_common_leaf (*iter))
-      {
-        m_red_rightCurves.erase(iter);
-        return;
-      }
-    }
-    return;
+    _remove_curve(m_leftCurves[Color::index], curve);
   }
 
-  void remove_blue_curve_from_right (Subcurve* curve)
+  /*! Remove a curve from the set of right curves. */
+  template<class Color>
+  void remove_curve_from_right (Subcurve* curve, Color)
   {
-    Subcurve_iterator iter;
-
-    for (iter = m_blue_rightCurves.begin(); iter!= m_blue_rightCurves.end(); ++iter)
-    {
-      if(curve->has_common_leaf (*iter))
-      {
-        m_blue_rightCurves.erase(iter);
-        return;
-      }
-    }
-    return;
+    _remove_curve(m_rightCurves[Color::index], curve);
   }
 
-
   /*! Returns an iterator to the first curve to the left of the event. */
-  Subcurve_iterator red_left_curves_begin()
+  template<class Color>
+  Subcurve_iterator left_curves_begin(Color)
   {
-    return (m_red_leftCurves.begin());
+    return (m_leftCurves[Color::index].begin());
   }
 
   /*! Returns an iterator to the one past the last curve to the left
       of the event. */
-  Subcurve_iterator red_left_curves_end()
+  template<class Color>
+  Subcurve_iterator left_curves_end(Color)
   {
-    return (m_red_leftCurves.end());
+    return (m_leftCurves[Color::index].end());
   }
 
   /*! Returns an iterator to the first curve to the right of the event. */
-  Subcurve_iterator red_right_curves_begin()
+  template<class Color>
+  Subcurve_iterator right_curves_begin(Color)
   {
-    return (m_red_rightCurves.begin());
+    return (m_rightCurves[Color::index].begin());
   }
 
   /*! Returns an iterator to the one past the last curve to the right
       of the event. */
-  Subcurve_iterator red_right_curves_end()
-  {
-    return (m_red_rightCurves.end());
-  }
-
-  /*! Returns a reverse_iterator to the first curve of the reversed list
-      of the right curves of the event. */
-  Subcurve_reverse_iterator red_right_curves_rbegin()
+  template<class Color>
+  Subcurve_iterator right_curves_end(Color)
   {
-    return (m_red_rightCurves.rbegin());
-  }
-
-  /*! Returns a reverse_iterator to the past-end curve of the reversed list
-      of the right curves of the event. */
-  Subcurve_reverse_iterator red_right_curves_rend()
-  {
-    return (m_red_rightCurves.rend());
-  }
-
-  /*! Returns a reverse_iterator to the first curve of the reversed list
-      of the left curves of the event. */
-  Subcurve_reverse_iterator red_left_curves_rbegin()
-  {
-    return (m_red_leftCurves.rbegin());
-  }
-
-  /*! Returns a reverse_iterator to the past-end curve of the reversed list
-      of the left curves of the event. */
-  Subcurve_reverse_iterator red_left_curves_rend()
-  {
-    return (m_red_leftCurves.rend());
+    return (m_rightCurves[Color::index].end());
   }
 
   /*! Returns the number of curves defined to the left of the event. */
-  unsigned int number_of_red_left_curves() {
-    return m_red_leftCurves.size();
-  }
-
-  /*! Returns the number of curves defined to the right of the event. */
-  unsigned int number_of_red_right_curves()
+  template<class Color>
+  unsigned int number_of_left_curves(Color)
   {
-    return (m_red_rightCurves.size());
-  }
-
-  /*! Checks if at least one curve is defined to the left of the event. */
-  bool has_red_left_curves() const
-  {
-    return (! m_red_leftCurves.empty());
-  }
-
-  /*! Checks if at least one curve is defined to the right of the event. */
-  bool has_red_right_curves() const
-  {
-    return (! m_red_rightCurves.empty());
-  }
-
-  /*! Returns an iterator to the first curve to the left of the event. */
-  Subcurve_iterator blue_left_curves_begin()
-  {
-    return (m_blue_leftCurves.begin());
-  }
-
-  /*! Returns an iterator to the one past the last curve to the left
-      of the event. */
-  Subcurve_iterator blue_left_curves_end()
-  {
-    return (m_blue_leftCurves.end());
-  }
-
-  /*! Returns an iterator to the first curve to the right of the event. */
-  Subcurve_iterator blue_right_curves_begin()
-  {
-    return (m_blue_rightCurves.begin());
-  }
-
-  /*! Returns an iterator to the one past the last curve to the right
-      of the event. */
-  Subcurve_iterator blue_right_curves_end()
-  {
-    return (m_blue_rightCurves.end());
-  }
-
-  /*! Returns a reverse_iterator to the first curve of the reversed list
-      of the right curves of the event. */
-  Subcurve_reverse_iterator blue_right_curves_rbegin()
-  {
-    return (m_blue_rightCurves.rbegin());
-  }
-
-  /*! Returns a reverse_iterator to the past-end curve of the reversed list
-      of the right curves of the event. */
-  Subcurve_reverse_iterator blue_right_curves_rend()
-  {
-    return (m_blue_rightCurves.rend());
-  }
-
-  /*! Returns a reverse_iterator to the first curve of the reversed list
-      of the left curves of the event. */
-  Subcurve_reverse_iterator blue_left_curves_rbegin()
-  {
-    return (m_blue_leftCurves.rbegin());
-  }
-
-  /*! Returns a reverse_iterator to the past-end curve of the reversed list
-      of the left curves of the event. */
-  Subcurve_reverse_iterator blue_left_curves_rend()
-  {
-    return (m_blue_leftCurves.rend());
-  }
-
-  /*! Returns the number of curves defined to the left of the event. */
-  unsigned int number_of_blue_left_curves() {
-    return m_blue_leftCurves.size();
+    return (m_leftCurves[Color::index].size());
   }
 
   /*! Returns the number of curves defined to the right of the event. */
-  unsigned int number_of_blue_right_curves()
+  template<class Color>
+  unsigned int number_of_right_curves(Color)
   {
-    return (m_blue_rightCurves.size());
+    return (m_rightCurves[Color::index].size());
   }
 
-
   /*! Checks if at least one curve is defined to the left of the event. */
-  bool has_blue_left_curves() const
+  template<class Color>
+  bool has_left_curves(Color) const
   {
-    return (! m_blue_leftCurves.empty());
+    return (! m_leftCurves[Color::index].empty());
   }
 
   /*! Checks if at least one curve is defined to the right of the event. */
-  bool has_blue_right_curves() const
+  template<class Color>
+  bool has_right_curves(Color) const
   {
-    return (! m_blue_rightCurves.empty());
+    return (! m_rightCurves[Color::index].empty());
   }
 
+  /*! Checks if at least one curve of either color is defined to the left
+      of the event. */
   bool has_left_curves() const
   {
-    return (has_red_left_curves() || has_blue_left_curves());
+    return (has_left_curves(Red_tag()) || has_left_curves(Blue_tag()));
   }
 
+  /*! Checks if at least one curve of either color is defined to the right
+      of the event. */
   bool has_right_curves() const
   {
-    return (has_red_right_curves() || has_blue_right_curves());
+    return (has_right_curves(Red_tag()) || has_right_curves(Blue_tag()));
   }
 
   /*!
@@ -583,15 +391,10 @@ public:
    */
   const X_monotone_curve_2& curve () const
   {
-    if (has_red_left_curves())
-      return (m_red_leftCurves.front()->last_curve());
+    if (has_left_curves(Red_tag()))
+      return (m_leftCurves[Red_tag::index].front()->last_curve());
 
-    return (m_red_rightCurves.front()->last_curve());
-
-    if (has_blue_left_curves())
-      return (m_blue_leftCurves.front()->last_curve());
-
-    return (m_blue_rightCurves.front()->last_curve());
+    return (m_rightCurves[Red_tag::index].front()->last_curve());
   }
 
   /*! Set the event point. */
@@ -711,26 +514,11 @@ public:
   //@}
 
   /*! Replace the set of left subcurves. */
-  template <class InputIterator>
-  void replace_red_left_curves (InputIterator begin, InputIterator end)
-  {
-    Subcurve_iterator left_iter = m_red_leftCurves.begin();
-    InputIterator     iter;
-
-    for (iter = begin; iter != end; ++iter, ++left_iter)
-    {
-      *left_iter = static_cast<Subcurve*>(*iter);
-    }
-
-    m_red_leftCurves.erase (left_iter, m_red_leftCurves.end());
-    return;
-  }
-
-  /*! Replace the set of left subcurves. */
-  template <class InputIterator>
-  void replace_blue_left_curves (InputIterator begin, InputIterator end)
+  template <class InputIterator, class Color>
+  void replace_left_curves (InputIterator begin, InputIterator end, Color)
   {
-    Subcurve_iterator left_iter = m_blue_leftCurves.begin();
+    Subcurve_container& left_curves = m_leftCurves[Color::index];
+    Subcurve_iterator left_iter = left_curves.begin();
     InputIterator     iter;
 
     for (iter = begin; iter != end; ++iter, ++left_iter)
@@ -738,12 +526,10 @@ public:
       *left_iter = static_cast<Subcurve*>(*iter);
     }
 
-    m_blue_leftCurves.erase (left_iter, m_blue_leftCurves.end());
+    left_curves.erase (left_iter, left_curves.end());
     return;
   }
 
-
-
 //  bool is_right_curve_bigger_from_red (Subcurve* c1, Subcurve* c2)
 //  {
 //    Subcurve_iterator   iter;
@@ -815,6 +601,24 @@ public:
 
   void Print() ;
 
+protected:
+
+  // remove the first curve sharing a leaf with curve
+  void _remove_curve (Subcurve_container& curves, Subcurve* curve)
+  {
+    Subcurve_iterator iter;
+
+    for (iter = curves.begin(); iter!= curves.end(); ++iter)
+    {
+      if(curve->has_common_leaf (*iter))
+      {
+        curves.erase(iter);
+        return;
+      }
+    }
+    return;
+  }
+
 };
 
   template<class Traits, class Subcurve>
@@ -847,8 +651,8 @@ public:
     std::cout<<"\n";
 
     std::cout << "\tRed Left curves: \n" ;
-    for ( Subcurve_iterator iter = m_red_leftCurves.begin() ;
-          iter != m_red_leftCurves.end() ; ++iter )
+    for ( Subcurve_iterator iter = m_leftCurves[Red_tag::index].begin() ;
+          iter != m_leftCurves[Red_tag::index].end() ; ++iter )
     {
       std::cout << "\t";
       (*iter)->Print();
@@ -857,8 +661,8 @@ public:
     std::cout << std::endl;
 
     std::cout << "\tBlue Left curves: \n" ;
-    for ( Subcurve_iterator iter = m_blue_leftCurves.begin() ;
-          iter != m_blue_leftCurves.end() ; ++iter )
+    for ( Subcurve_iterator iter = m_leftCurves[Blue_tag::index].begin() ;
+          iter != m_leftCurves[Blue_tag::index].end() ; ++iter )
     {
       std::cout << "\t";
       (*iter)->Print();
@@ -867,8 +671,8 @@ public:
     std::cout << std::endl;
 
     std::cout << "\tRed Right curves: \n" ;
-    for ( Subcurve_iterator iter1 = m_red_rightCurves.begin() ;
-          iter1 != m_red_rightCurves.end() ; ++iter1 )
+    for ( Subcurve_iterator iter1 = m_rightCurves[Red_tag::index].begin() ;
+          iter1 != m_rightCurves[Red_tag::index].end() ; ++iter1 )
     {
       std::cout << "\t";
       (*iter1)->Print();
@@ -878,8 +682,8 @@ public:
     std::cout << std::endl;
 
     std::cout << "\tBlue Right curves: \n" ;
-    for ( Subcurve_iterator iter = m_blue_rightCurves.begin() ;
-          iter != m_blue_rightCurves.end() ; ++iter )
+    for ( Subcurve_iterator iter = m_rightCurves[Blue_tag::index].begin() ;
+          iter != m_rightCurves[Blue_tag::index].end() ; ++iter )
     {
       std::cout << "\t";
       (*iter)->Print();
@@ -23,6 +23,10 @@
 #ifndef MY_CGAL_SWEEP_LINE_FUNCTORS_H
 #define MY_CGAL_SWEEP_LINE_FUNCTORS_H
 
+#include <CGAL/Bbox_2.h>
+#include "My_Arr_mirrored_traits_2.h"
+#include <utility>
+
 /*! \file
  * Comparison functors used by the sweep-line algorithm.
  */
@@ -50,7 +54,6 @@ typedef    typename Traits_2::Point_2 Point_2;
 
     // Data members:
     Traits_2 *m_traits; // A geometric-traits object.
-    Kernel kernel;
 
     Arr_parameter_space m_ps_in_x; // Storing curve information when
     Arr_parameter_space m_ps_in_y; // comparing a curve end with
@@ -291,7 +294,7 @@ typedef    typename Traits_2::Point_2 Point_2;
     // adapted by Jannis Warnat
     inline Arr_curve_end _curve_end (const Event* e) const
       {
-        if(e->has_red_left_curves() || e->has_blue_left_curves())
+        if(e->has_left_curves())
           {
             if(e->is_right_end())
               {
@@ -324,6 +327,19 @@ typedef    typename Traits_2::Point_2 Point_2;
 template<class Traits, class Subcurve>
   class My_Sweep_line_event;
 
+// The bits of a scout in the summaries of the scout set, by Jannis Warnat
+
+template<class Scout_>
+  class Scout_summary
+  {
+  public:
+
+    unsigned int operator()(Scout_* s) const
+      {
+        return s->summary_bits();
+      }
+  };
+
 // A functor used to compare scouts along the status line, by Jannis Warnat
 
 template<class Traits_, class Subcurve_, class Scout_>
@@ -418,6 +434,7 @@ template<class Traits_, class Subcurve_>
     typedef Arr_traits_basic_adaptor_2<Traits_2> Traits_adaptor_2;
 
 typedef    typename Traits_2::Base_point_2 Base_point_2;
+    typedef typename Traits_2::Traits_2 Base_traits_2;
     typedef typename Traits_adaptor_2::Point_2 Point_2;
     typedef My_Sweep_line_event<Traits_2, Subcurve> Event;
 
@@ -426,6 +443,51 @@ typedef    typename Traits_2::Base_point_2 Base_point_2;
     Traits_adaptor_2 *m_traits; // A geometric-traits object.
     Event **m_curr_event; // Points to the current event point.
 
+    /*!
+     * Order c1 and c2 at the x-coordinate of the current event by the
+     * y-intervals the subcurves cache there; this is their order in the
+     * status line if the intervals are disjoint, since then the curves do
+     * not meet at that x.
+     * \return false if the intervals do not decide.
+     */
+    bool _compare_cached_y(const Subcurve *c1, const Subcurve *c2,
+        Comparison_result& res) const
+      {
+        const Event* event = *m_curr_event;
+        if(event == NULL || event->x_index() == 0)
+          {
+            return false;
+          }
+
+        Bbox_2 box = event->point().base().bbox();
+        std::pair<double, double> x(box.xmin(), box.xmax());
+        std::pair<double, double> y1, y2;
+        if(!c1->y_at_x(event->x_index(), x, y1)
+            || !c2->y_at_x(event->x_index(), x, y2))
+          {
+            return false;
+          }
+
+        if(y1.second < y2.first)
+          {
+            res = SMALLER;
+          }
+        else if(y2.second < y1.first)
+          {
+            res = LARGER;
+          }
+        else
+          {
+            return false;
+          }
+
+        // the mirrored sweep sees the y-order reversed
+        if(Sweep_is_mirrored<Base_traits_2>::value)
+          {
+            res = CGAL::opposite(res);
+          }
+        return true;
+      }
 
   public:
 
@@ -458,23 +520,32 @@ typedef    typename Traits_2::Base_point_2 Base_point_2;
             return EQUAL;
           }
 
-        // get the base points of the curve endpoints
-        Base_point_2 c1_left_base = c1->last_curve().base().left();
-        Base_point_2 c2_left_base = c2->last_curve().base().left();
-        Base_point_2 c1_right_base = c1->last_curve().base().right();
-        Base_point_2 c2_right_base = c2->last_curve().base().right();
+        // curves apart at the x of the current event need no exact predicate
+        Comparison_result cached_res;
+        if(_compare_cached_y(c1, c2, cached_res))
+          {
+            return cached_res;
+          }
+
+        // get the base points of the curve endpoints; left and right as seen
+        // by the sweep, which may run from right to left
+        const Base_traits_2* base_tr = m_traits->base_traits();
+        Base_point_2 c1_left_base = base_tr->construct_min_vertex_2_object()(c1->last_curve().base());
+        Base_point_2 c2_left_base = base_tr->construct_min_vertex_2_object()(c2->last_curve().base());
+        Base_point_2 c1_right_base = base_tr->construct_max_vertex_2_object()(c1->last_curve().base());
+        Base_point_2 c2_right_base = base_tr->construct_max_vertex_2_object()(c2->last_curve().base());
 
         // left endpoints are equal, compare to the right
         if(c1_left_base == c2_left_base)
           {
-            Comparison_result res = m_traits->base_traits()->compare_y_at_x_right_2_object()(c1->last_curve().base(),c2->last_curve().base(),c1_left_base);
+            Comparison_result res = base_tr->compare_y_at_x_right_2_object()(c1->last_curve().base(),c2->last_curve().base(),c1_left_base);
             return res;
           }
 
         // right endpoints are equal, compare to the left
         if(c1_right_base == c2_right_base)
           {
-            Comparison_result res = m_traits->base_traits()->compare_y_at_x_left_2_object()(c1->last_curve().base(),c2->last_curve().base(),c1_right_base);
+            Comparison_result res = base_tr->compare_y_at_x_left_2_object()(c1->last_curve().base(),c2->last_curve().base(),c1_right_base);
             return res;
           }
 
@@ -482,45 +553,18 @@ typedef    typename Traits_2::Base_point_2 Base_point_2;
         Comparison_result c1_right_to_c2;
 
         // we want to avoid computing an intersection as long as possible;
-        // compare the relative position of the endpoints of c1 to c2
+        // compare the relative position of the endpoints of c1 to c2; for a
+        // non-vertical c2 this is the orientation of the endpoint relative
+        // to c2 directed from left to right
         if(c2->last_curve().base().is_vertical())
           {
-            if (c1_left_base.x() == c2->last_curve().base().left().x())
-              {
-                c1_left_to_c2 = EQUAL;
-              }
-            else
-              {
-                if(c1_left_base.x() < c2->last_curve().base().left().x())
-                  {
-                    c1_left_to_c2 = SMALLER;
-                  }
-                else
-                  {
-                    c1_left_to_c2 = LARGER;
-                  }
-              }
-
-            if (c1_right_base.x() == c2->last_curve().base().left().x())
-              {
-                c1_right_to_c2 = EQUAL;
-              }
-            else
-              {
-                if(c1_right_base.x() < c2->last_curve().base().left().x())
-                  {
-                    c1_right_to_c2 = SMALLER;
-                  }
-                else
-                  {
-                    c1_right_to_c2 = LARGER;
-                  }
-              }
+            c1_left_to_c2 = base_tr->compare_x_2_object()(c1_left_base,c2_left_base);
+            c1_right_to_c2 = base_tr->compare_x_2_object()(c1_right_base,c2_left_base);
           }
         else
           {
-            c1_left_to_c2 = m_traits->kernel.compare_y_at_x_2_object()(c1_left_base,c2->last_curve().base().line());
-            c1_right_to_c2 = m_traits->kernel.compare_y_at_x_2_object()(c1_right_base,c2->last_curve().base().line());
+            c1_left_to_c2 = m_traits->kernel.orientation_2_object()(c2_left_base,c2_right_base,c1_left_base);
+            c1_right_to_c2 = m_traits->kernel.orientation_2_object()(c2_left_base,c2_right_base,c1_right_base);
           }
 
         // c1 is below c2
@@ -539,42 +583,13 @@ typedef    typename Traits_2::Base_point_2 Base_point_2;
         Comparison_result c2_right_to_c1;
         if(c1->last_curve().base().is_vertical())
           {
-            if (c2_left_base.x() == c1->last_curve().base().left().x())
-              {
-                c2_left_to_c1 = EQUAL;
-              }
-            else
-              {
-                if(c2_left_base.x() < c1->last_curve().base().left().x())
-                  {
-                    c2_left_to_c1 = SMALLER;
-                  }
-                else
-                  {
-                    c2_left_to_c1 = LARGER;
-                  }
-              }
-
-            if (c2_right_base.x() == c1->last_curve().base().left().x())
-              {
-                c2_right_to_c1 = EQUAL;
-              }
-            else
-              {
-                if(c2_right_base.x() < c1->last_curve().base().left().x())
-                  {
-                    c2_right_to_c1 = SMALLER;
-                  }
-                else
-                  {
-                    c2_right_to_c1 = LARGER;
-                  }
-              }
+            c2_left_to_c1 = base_tr->compare_x_2_object()(c2_left_base,c1_left_base);
+            c2_right_to_c1 = base_tr->compare_x_2_object()(c2_right_base,c1_left_base);
           }
         else
           {
-            c2_left_to_c1 = m_traits->kernel.compare_y_at_x_2_object()(c2_left_base,c1->last_curve().base().line());
-            c2_right_to_c1 = m_traits->kernel.compare_y_at_x_2_object()(c2_right_base,c1->last_curve().base().line());
+            c2_left_to_c1 = m_traits->kernel.orientation_2_object()(c1_left_base,c1_right_base,c2_left_base);
+            c2_right_to_c1 = m_traits->kernel.orientation_2_object()(c1_left_base,c1_right_base,c2_right_base);
           }
 
         // c2 is below c1
@@ -588,28 +603,41 @@ typedef    typename Traits_2::Base_point_2 Base_point_2;
             return SMALLER;
           }
 
-        // now we have to compute the intersection point ip after all
-        std::vector<Object> obj_vec;
-        m_traits->base_traits()->intersect_2_object()(c1->last_curve().base(),
-            c2->last_curve().base(),
-            std::back_inserter(obj_vec));
-        std::pair<Base_point_2, unsigned int> base_ipt;
-        base_ipt = object_cast<std::pair<Base_point_2, unsigned int> >(obj_vec.front());
-        Base_point_2 ip = base_ipt.first;
+        // now we need the intersection point ip after all, unless it is
+        // memorized for the input segments of the curves
+        Base_point_2 ip;
+        const Base_point_2* crossing =
+            m_traits->memorized_crossing(c1->last_curve(), c2->last_curve());
+        if(crossing != NULL)
+          {
+            ip = *crossing;
+          }
+        else
+          {
+            std::vector<Object> obj_vec;
+            base_tr->intersect_2_object()(c1->last_curve().base(),
+                c2->last_curve().base(),
+                std::back_inserter(obj_vec));
+            std::pair<Base_point_2, unsigned int> base_ipt;
+            base_ipt = object_cast<std::pair<Base_point_2, unsigned int> >(obj_vec.front());
+            ip = base_ipt.first;
+            m_traits->memorize_crossing(c1->last_curve(), c2->last_curve(), ip);
+          }
 
         // we need to compare the intersection point to the current event point
         Base_point_2 event_point = (*m_curr_event)->point().base();
+        Comparison_result event_to_ip = base_tr->compare_xy_2_object()(event_point,ip);
 
         // compare to the left
-        if(event_point < ip)
+        if(event_to_ip == SMALLER)
           {
-            Comparison_result res = m_traits->base_traits()->compare_y_at_x_left_2_object()(c1->last_curve().base(),c2->last_curve().base(),ip);
+            Comparison_result res = base_tr->compare_y_at_x_left_2_object()(c1->last_curve().base(),c2->last_curve().base(),ip);
             return res;
           }
         // compare to the right
-        if(event_point> ip)
+        if(event_to_ip == LARGER)
           {
-            Comparison_result res = m_traits->base_traits()->compare_y_at_x_right_2_object()(c1->last_curve().base(),c2->last_curve().base(),ip);
+            Comparison_result res = base_tr->compare_y_at_x_right_2_object()(c1->last_curve().base(),c2->last_curve().base(),ip);
             return res;
           }
       }
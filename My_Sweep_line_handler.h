@@ -28,41 +28,36 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
         return;
       }
 
-    //red or blue
-    this->current_event_point_color = this->current_event_point.color();
-
-    //extract the arrangement vertex from the current event point
-    if (this->current_event_point_color == Traits_2::RED)
+    //red or blue, the only test of the color of the event
+    if (this->current_event_point.color() == Traits_2::RED)
       {
-        try
-          {
-            this->current_vertex = object_cast<Vertex_const_handle> (
-                this->current_event_point.red_object());
-          }
-        catch (Bad_object_cast)
-          {
-            CGAL_assertion(false);
-          }
+        proceed_according_to_vertex_type(Red_tag());
       }
     else
       {
-        try
-          {
-            this->current_vertex = object_cast<Vertex_const_handle> (
-                this->current_event_point.blue_object());
-          }
-        catch (Bad_object_cast)
-          {
-            CGAL_assertion(false);
-          }
+        proceed_according_to_vertex_type(Blue_tag());
       }
+  }
+
+// ---------------------------------------------------------------------------
+// The same for a red or blue event, everything called from here handles
+// the curves of the color of the tag
+
+template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
+  void
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::proceed_according_to_vertex_type(
+      Color)
+  {
+    //extract the arrangement vertex from the current event point
+    set_current_vertex(Color());
 
     Vertex_type p_type = this->current_vertex->data().type();
 
     //point is nothing of the types below
     if (p_type == DEFAULT)
       {
-        handle_default();
+        handle_default(Color());
       }
 
     //if delegate_to_next_default was set it is not needed
@@ -72,36 +67,54 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     if (p_type == INTERNAL_ENDPOINT)
       {
         //endpoint is either left or right endpoint
-        if (this->m_currentEvent->has_left_curves())
+        if (this->m_currentEvent->has_left_curves(Color()))
           {
-            handle_right_endpoint();
+            handle_right_endpoint(Color());
           }
         else
           {
-            handle_left_endpoint();
+            handle_left_endpoint(Color());
           }
       }
 
     //happens only once per sweep
     if (p_type == POINT_X)
       {
-        handle_point_x();
+        handle_point_x(Color());
       }
   }
 
+// ---------------------------------------------------------------------------
+// The arrangement vertex of the current event point of the color of the tag
+
+template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+  void
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::set_current_vertex(Red_tag)
+  {
+    this->current_vertex = this->current_event_point.red_vertex_handle();
+  }
+
+template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+  void
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::set_current_vertex(Blue_tag)
+  {
+    this->current_vertex = this->current_event_point.blue_vertex_handle();
+  }
+
 // ---------------------------------------------------------------------------
 // Helper function called from handle_default(), the scout jumps from the left
 // curve to the correct right curve
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
   My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::change_boundary_of_upper_scout(
-      Subcv* left_curve)
+      Subcv* left_curve, Color)
   {
     MY_CGAL_SL_PRINT("begin change_boundary_of_upper_scout()");
 
     //get lower curve at current event
-    Event_subcurve_iterator right_begin = this->right_curves_begin();
+    Event_subcurve_iterator right_begin = this->right_curves_begin(Color());
     Subcurve* right_curve = *right_begin;
 
     if (left_curve->has_upper_scout())
@@ -135,14 +148,15 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 //
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
   My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::change_boundary_of_lower_scout(
-      Subcv* left_curve)
+      Subcv* left_curve, Color)
   {
     MY_CGAL_SL_PRINT("begin change_boundary_of_lower_scout()");
 
     //get upper curve at current event
-    Event_subcurve_iterator right_end = this->right_curves_end();
+    Event_subcurve_iterator right_end = this->right_curves_end(Color());
     right_end--;
     Subcurve* right_curve = *right_end;
 
@@ -177,15 +191,16 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 //
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
   My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::change_assignment_of_upper_guard(
-      Subcv* left_curve)
+      Subcv* left_curve, Color)
   {
     MY_CGAL_SL_PRINT("begin change_assignment_of_upper_guard()");
 
-    Event_subcurve_iterator right_begin = this->right_curves_begin();
-    Event_subcurve_iterator right_end = this->right_curves_end();
-    Status_line* status_line = this->same_colored_status_line();
+    Event_subcurve_iterator right_begin = this->right_curves_begin(Color());
+    Event_subcurve_iterator right_end = this->right_curves_end(Color());
+    Status_line* status_line = this->same_colored_status_line(Color());
 
     if (left_curve->is_guarded_by_upper_scout())
       {
@@ -233,14 +248,15 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 //
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
   My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::change_assignment_of_lower_guard(
-      Subcv* left_curve)
+      Subcv* left_curve, Color)
   {
     MY_CGAL_SL_PRINT("begin change_assignment_of_lower_guard()");
 
-    Event_subcurve_iterator right_begin = this->right_curves_begin();
-    Event_subcurve_iterator right_end = this->right_curves_end();
+    Event_subcurve_iterator right_begin = this->right_curves_begin(Color());
+    Event_subcurve_iterator right_end = this->right_curves_end(Color());
 
     if (left_curve->is_guarded_by_lower_scout())
       {
@@ -259,16 +275,8 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
           {
             //left_curve curve ends here (right endpoint), guard closest curve below;
             //no geometric search on the status line necessary
-            Subcurve* below_curve;
+            Subcurve* below_curve = this->current_below(Color());
 
-            if (this->current_event_point_color == Traits_2::RED)
-              {
-                below_curve = this->current_red_below();
-              }
-            else
-              {
-                below_curve = this->current_blue_below();
-              }
             //there is no curve below
             if (below_curve == 0)
               {
@@ -292,17 +300,18 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // Handles events/vertices/points of type DEFAULT
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::handle_default()
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::handle_default(Color)
   {
     MY_CGAL_SL_PRINT("begin handle_default");
 
     //one or two left curves and one or two right curves of the same color
-    Event_subcurve_iterator left_begin = this->left_curves_begin();
-    Event_subcurve_iterator left_end = this->left_curves_end();
-    Event_subcurve_iterator right_begin = this->right_curves_begin();
-    int number_of_right_curves = this->number_of_right_curves();
-    int number_of_left_curves = this->number_of_left_curves();
+    Event_subcurve_iterator left_begin = this->left_curves_begin(Color());
+    Event_subcurve_iterator left_end = this->left_curves_end(Color());
+    Event_subcurve_iterator right_begin = this->right_curves_begin(Color());
+    int number_of_right_curves = this->number_of_right_curves(Color());
+    int number_of_left_curves = this->number_of_left_curves(Color());
 
     //we have up to two left curves, call them "left_lower" and "left_upper"
     if (number_of_left_curves != 0)
@@ -325,26 +334,26 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
           }
 
         //only the lowest can be guarded by an upper scout
-        change_assignment_of_upper_guard(left_lower);
+        change_assignment_of_upper_guard(left_lower, Color());
 
         //move a possible upper scout
-        change_boundary_of_upper_scout(left_lower);
+        change_boundary_of_upper_scout(left_lower, Color());
 
         //left upper, can be the same as left lower
         left_end--;
         left_upper = *left_end;
 
         //only the highest can be guarded by a lower scout
-        change_assignment_of_lower_guard(left_upper);
+        change_assignment_of_lower_guard(left_upper, Color());
 
         //move a possible lower scout
-        change_boundary_of_lower_scout(left_upper);
+        change_boundary_of_lower_scout(left_upper, Color());
       }
 
     //we may have to start a new region
     if (this->delegated_to_next_default())
       {
-        start_region();
+        start_region(Color());
       }
 
     //the curves currently below may change, store them with the sweep line
@@ -374,14 +383,7 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
         //update current curves below if appropriate
         if (!is_vertical || (is_vertical && number_of_right_curves == 2))
           {
-            if (this->current_event_point_color == Traits_2::RED)
-              {
-                this->set_current_red_below(right_upper_non_vertical);
-              }
-            else
-              {
-                this->set_current_blue_below(right_upper_non_vertical);
-              }
+            this->set_current_below(right_upper_non_vertical, Color());
           }
       }
   }
@@ -427,10 +429,9 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
           }
       }
 
+    //the scouts stay in the arena until the sweep is complete
     lower->delete_lower_scout();
-    delete lower;
     upper->delete_upper_scout();
-    delete upper;
   }
 
 // ---------------------------------------------------------------------------
@@ -454,10 +455,9 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
         upper->insert_into_purple_arr();
       }
 
+    //the scouts stay in the arena until the sweep is complete
     lower->delete_lower_scout();
-    delete lower;
     upper->delete_upper_scout();
-    delete upper;
   }
 
 // ---------------------------------------------------------------------------
@@ -465,18 +465,19 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // specifically right endpoints
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::handle_right_endpoint()
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::handle_right_endpoint(Color)
   {
     MY_CGAL_SL_PRINT("begin handle_right_endpoint");
 
     //one left curve, no right curves
-    Event_subcurve_iterator left_begin = this->left_curves_begin();
+    Event_subcurve_iterator left_begin = this->left_curves_begin(Color());
     Subcurve* left_curve = *left_begin;
 
     //inform possible guards
-    change_assignment_of_upper_guard(left_curve);
-    change_assignment_of_lower_guard(left_curve);
+    change_assignment_of_upper_guard(left_curve, Color());
+    change_assignment_of_lower_guard(left_curve, Color());
 
     //end the region above the left curve
     if (left_curve->has_lower_scout())
@@ -493,14 +494,14 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
       }
 
     //only start the region if point is red and blue face containing point_x
-    if (!this->is_in_face_x())
+    if (!is_in_face_x(Color()))
       {
         return;
       }
 
     // from now on the event can be handled exactly as if it was
     // of type X
-    handle_point_x();
+    handle_point_x(Color());
   }
 
 // ---------------------------------------------------------------------------
@@ -508,14 +509,15 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // since a new curve starts it may have to be guarded from below
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::inform_guard_below()
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::inform_guard_below(Color)
   {
     MY_CGAL_SL_PRINT("begin inform_guard_below()");
 
     //the right curve may be guarded from below
-    Event_subcurve_iterator right_begin = this->right_curves_begin();
-    Status_line* status_line = this->different_colored_status_line();
+    Event_subcurve_iterator right_begin = this->right_curves_begin(Color());
+    Status_line* status_line = this->different_colored_status_line(Color());
     Subcurve* right_curve = *right_begin;
 
     //find_lower finds the closest curve above of the opposite color...
@@ -559,14 +561,15 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 //
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::inform_guard_above()
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::inform_guard_above(Color)
   {
     MY_CGAL_SL_PRINT("begin inform_guard_above()");
 
     //the right curve may be guarded from above
-    Event_subcurve_iterator right_begin = this->right_curves_begin();
-    Status_line* status_line = this->different_colored_status_line();
+    Event_subcurve_iterator right_begin = this->right_curves_begin(Color());
+    Status_line* status_line = this->different_colored_status_line(Color());
     Subcurve* right_curve = *right_begin;
 
     //find the next curve above of the opposite color
@@ -601,41 +604,22 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
   bool
-  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::is_in_face_x()
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::is_in_face_x(Red_tag)
   {
     MY_CGAL_SL_PRINT("begin is_in_face_x");
-    bool is_in_f_x = true;
 
     //only if a point is represented by both a red and a blue vertex
     //a region needs to be started
-    Vertex_const_handle ext;
-    if (this->current_event_point_color == Traits_2::RED)
-      {
-        try
-          {
-            ext = object_cast<Vertex_const_handle> (
-                this->current_event_point.blue_object());
-          }
-        catch (Bad_object_cast)
-          {
-            MY_CGAL_SL_PRINT("Bad object cast");
-            is_in_f_x = false;
-          }
-      }
-    else
-      {
-        try
-          {
-            ext = object_cast<Vertex_const_handle> (
-                this->current_event_point.red_object());
-          }
-        catch (Bad_object_cast)
-          {
-            MY_CGAL_SL_PRINT("Bad object cast");
-            is_in_f_x = false;
-          }
-      }
-    return is_in_f_x;
+    return !this->current_event_point.is_blue_vertex_empty();
+  }
+
+template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+  bool
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::is_in_face_x(Blue_tag)
+  {
+    MY_CGAL_SL_PRINT("begin is_in_face_x");
+
+    return !this->current_event_point.is_red_vertex_empty();
   }
 
 // ---------------------------------------------------------------------------
@@ -643,35 +627,29 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 // specifically left endpoints
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::handle_left_endpoint()
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::handle_left_endpoint(Color)
   {
     MY_CGAL_SL_PRINT("begin handle_left_endpoint");
 
     //no left curves, one right curve
-    Event_subcurve_iterator right_begin = this->right_curves_begin();
+    Event_subcurve_iterator right_begin = this->right_curves_begin(Color());
     Subcurve* right_curve = *right_begin;
     bool is_vertical = right_curve->last_curve().base().is_vertical();
 
     //a new curve starts here, which may have to be guarded from above...
-    inform_guard_above();
+    inform_guard_above(Color());
     //...and / or below
-    inform_guard_below();
+    inform_guard_below(Color());
 
     //check if we have to start a region...
-    if (!this->is_in_face_x())
+    if (!is_in_face_x(Color()))
       {
         if (!is_vertical)
           {
             //...if not, do not start a region but update the current curves below
-            if (this->current_event_point_color == Traits_2::RED)
-              {
-                this->set_current_red_below(right_curve);
-              }
-            else
-              {
-                this->set_current_blue_below(right_curve);
-              }
+            this->set_current_below(right_curve, Color());
           }
         return;
       }
@@ -679,7 +657,7 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     this->next_region_is_unbounded_above(false);
 
     //...if so, start the region below the right curve...
-    start_region();
+    start_region(Color());
 
     //...and order the region above the right curve to be started
     //at the next event of type DEFAULT if there is one
@@ -690,15 +668,7 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     if (!is_vertical)
       {
         this->delegate_to_next_default();
-
-        if (this->current_event_point_color == Traits_2::RED)
-          {
-            this->set_current_red_below(right_curve);
-          }
-        else
-          {
-            this->set_current_blue_below(right_curve);
-          }
+        this->set_current_below(right_curve, Color());
       }
 
     //if there is nothing above, start the region above the right curve here...
@@ -707,7 +677,7 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
         //...but only if the right curve is not vertical
         if (!is_vertical)
           {
-            start_region();
+            start_region(Color());
           }
         else
           {
@@ -721,8 +691,9 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 //
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::handle_point_x()
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::handle_point_x(Color)
   {
     MY_CGAL_SL_PRINT("begin handle_point_x");
 
@@ -735,7 +706,7 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     //if there is no vertex above, start the region here...
     if (this->is_next_region_unbounded_above())
       {
-        start_region();
+        start_region(Color());
       }
     else
       {
@@ -749,8 +720,9 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 //
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   void
-  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::start_region()
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::start_region(Color)
   {
     MY_CGAL_SL_PRINT("begin start_region()");
     this->reset_delegation();
@@ -758,10 +730,10 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     //start two new partner scouts
     My_Scout* upper_partner;
     My_Scout* lower_partner;
-    lower_partner = start_lower_scout();
+    lower_partner = start_lower_scout(Color());
     Scout_set_iterator low_it = lower_partner->scout_set_position();
     low_it++;
-    upper_partner = start_upper_scout(low_it);
+    upper_partner = start_upper_scout(low_it, Color());
     lower_partner->set_partner(upper_partner);
     upper_partner->set_partner(lower_partner);
 
@@ -780,24 +752,25 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 //
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   typename My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::My_Scout*
   My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::start_upper_scout(
-      Scout_set_iterator lower)
+      Scout_set_iterator lower, Color)
   {
     MY_CGAL_SL_PRINT("begin start_upper_scout()");
 
-    Status_line* status_line = this->different_colored_status_line();
+    Status_line* status_line = this->different_colored_status_line(Color());
 
     //the scout might be a dummy...
     if (this->is_next_region_unbounded_above())
       {
-        My_Scout* upper = new My_Scout(this->dummy_sub, My_Scout::UPPER_DUMMY, this);
+        My_Scout* upper = new (this->m_scout_arena.allocate()) My_Scout(this->dummy_sub, My_Scout::UPPER_DUMMY, this);
         this->upper_dummy = upper;
         return upper;
       }
 
     //...otherwise its boundary is the lower right curve at the current event
-    My_Scout* upper = new My_Scout(*(this->right_curves_begin()), My_Scout::UPPER, this,
+    My_Scout* upper = new (this->m_scout_arena.allocate()) My_Scout(*(this->right_curves_begin(Color())), My_Scout::UPPER, this,
         lower);
 
     //find the curve to guard...
@@ -819,8 +792,9 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 //
 
 template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
+template<class Color>
   typename My_Basic_sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::My_Scout*
-  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::start_lower_scout()
+  My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::start_lower_scout(Color)
   {
     MY_CGAL_SL_PRINT("begin start_lower_scout()");
 
@@ -834,7 +808,7 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
           }
 
         //start a new dummy and return it
-        My_Scout* lower = new My_Scout(this->dummy_sub, My_Scout::LOWER_DUMMY, this);
+        My_Scout* lower = new (this->m_scout_arena.allocate()) My_Scout(this->dummy_sub, My_Scout::LOWER_DUMMY, this);
         this->lower_dummy = lower;
         return lower;
       }
@@ -847,9 +821,9 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     // be the right curve at the current event
     if (this->current_vertex->data().type() == INTERNAL_ENDPOINT
         && this->is_next_region_unbounded_above()
-        && this->m_currentEvent->has_right_curves())
+        && this->m_currentEvent->has_right_curves(Color()))
       {
-        Event_subcurve_iterator right_end = this->right_curves_end();
+        Event_subcurve_iterator right_end = this->right_curves_end(Color());
         right_end--;
         below_curve = *right_end;
       }
@@ -874,7 +848,7 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
       }
 
     //initialize the scout
-    My_Scout* lower = new My_Scout(below_curve, My_Scout::LOWER, this);
+    My_Scout* lower = new (this->m_scout_arena.allocate()) My_Scout(below_curve, My_Scout::LOWER, this);
 
     //the curve to guard is the curve below of the other color
     Subcurve* other_below_curve;
@@ -908,8 +882,8 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 
     if (this->m_currentEvent->is_intersection())
       {
-        Subcurve* blue_left = *this->m_currentEvent->blue_left_curves_begin();
-        Subcurve* red_left = *this->m_currentEvent->red_left_curves_begin();
+        Subcurve* blue_left = *this->m_currentEvent->left_curves_begin(Blue_tag());
+        Subcurve* red_left = *this->m_currentEvent->left_curves_begin(Red_tag());
 
         //as an exception we are working left of the event point
         this->m_currentEvent->set_use_compare_y_at_x_left(true);
@@ -930,23 +904,22 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
 
         //temporarily erase the affected scouts from the scout set
         //because their order will change
-        Scout_set* m_scouts = this->get_scouts();
         if (red_left->has_upper_scout())
           {
-            m_scouts->erase(red_left->upper_scout()->scout_set_position());
+            red_left->upper_scout()->erase_from_scout_set();
           }
         if (red_left->has_lower_scout())
           {
-            m_scouts->erase(red_left->lower_scout()->scout_set_position());
+            red_left->lower_scout()->erase_from_scout_set();
           }
         if (blue_left->has_upper_scout())
           {
-            m_scouts->erase(blue_left->upper_scout()->scout_set_position());
+            blue_left->upper_scout()->erase_from_scout_set();
           }
 
         if (blue_left->has_lower_scout())
           {
-            m_scouts->erase(blue_left->lower_scout()->scout_set_position());
+            blue_left->lower_scout()->erase_from_scout_set();
           }
 
         //end of the exception
@@ -981,12 +954,11 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     //to the right;
     //erase the affected scouts from the scout set
     //because their order will change
-    Scout_set* m_scouts = this->get_scouts();
     if (non_vertical_left->has_upper_scout())
       {
         My_Scout* non_vertical_upper = non_vertical_left->upper_scout();
         non_vertical_upper->insert_into_purple_arr();
-        m_scouts->erase(non_vertical_upper->scout_set_position());
+        non_vertical_upper->erase_from_scout_set();
         non_vertical_upper->set_boundary_curve(non_vertical_right);
         non_vertical_right->set_upper_scout(non_vertical_upper);
         non_vertical_left->remove_upper_scout();
@@ -995,7 +967,7 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
       {
         My_Scout* non_vertical_lower = non_vertical_left->lower_scout();
         non_vertical_lower->insert_into_purple_arr();
-        m_scouts->erase(non_vertical_lower->scout_set_position());
+        non_vertical_lower->erase_from_scout_set();
         non_vertical_lower->set_boundary_curve(non_vertical_right);
         non_vertical_right->set_lower_scout(non_vertical_lower);
         non_vertical_left->remove_lower_scout();
@@ -1020,11 +992,11 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     //temporarily erase the scouts on the vertical segment from the scout set
     if (vertical->has_upper_scout())
       {
-        m_scouts->erase(vertical->upper_scout()->scout_set_position());
+        vertical->upper_scout()->erase_from_scout_set();
       }
     if (vertical->has_lower_scout())
       {
-        m_scouts->erase(vertical->lower_scout()->scout_set_position());
+        vertical->lower_scout()->erase_from_scout_set();
       }
 
     //end of the exception
@@ -1047,10 +1019,10 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
     //vertical segment is already split from the decomposition
     if (this->m_currentEvent->is_weak_intersection())
       {
-        Subcurve* blue_left = *this->m_currentEvent->blue_left_curves_begin();
-        Subcurve* red_left = *this->m_currentEvent->red_left_curves_begin();
-        Subcurve* blue_right = *this->m_currentEvent->blue_right_curves_begin();
-        Subcurve* red_right = *this->m_currentEvent->red_right_curves_begin();
+        Subcurve* blue_left = *this->m_currentEvent->left_curves_begin(Blue_tag());
+        Subcurve* red_left = *this->m_currentEvent->left_curves_begin(Red_tag());
+        Subcurve* blue_right = *this->m_currentEvent->right_curves_begin(Blue_tag());
+        Subcurve* red_right = *this->m_currentEvent->right_curves_begin(Red_tag());
 
         CGAL_assertion(blue_left->last_curve().base().is_vertical()
             || red_left->last_curve().base().is_vertical());
@@ -1088,8 +1060,8 @@ template<class Arr, class Tr, class Subcv, class Evnt, typename Alloc>
   My_Sweep_line_2<Arr, Tr, Subcv, Evnt, Alloc>::handle_red_blue_intersection()
   {
     MY_CGAL_SL_PRINT("begin handle_red_blue_intersection()");
-    Subcurve* blue_right = *this->m_currentEvent->blue_right_curves_begin();
-    Subcurve* red_right = *this->m_currentEvent->red_right_curves_begin();
+    Subcurve* blue_right = *this->m_currentEvent->right_curves_begin(Blue_tag());
+    Subcurve* red_right = *this->m_currentEvent->right_curves_begin(Red_tag());
 
     //there is exactly one red and exactly one blue left curve,
     //carrying one or two scouts; get these
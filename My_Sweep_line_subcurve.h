@@ -22,6 +22,8 @@
 #ifndef MY_CGAL_SWEEP_LINE_SUBCURVE_H
 #define MY_CGAL_SWEEP_LINE_SUBCURVE_H
 
+#include "My_Interval_filter.h"
+
 /*! \file
  * Defintion of the Sweep_line_subcurve class.
  */
@@ -111,6 +113,13 @@ template<class Arrangement_, class Traits_>
     // the right of the last event point
     // that occured on the curve.
 
+    Interval_segment m_interval; // The approximation of m_lastCurve.
+
+    mutable unsigned int m_y_x_index; // The x-index of the current event
+    // m_y_at_x was computed at, 0 if none.
+    mutable bool m_has_y_at_x; // Whether m_y_at_x is known there.
+    mutable std::pair<double, double> m_y_at_x; // The y-interval there.
+
     Event *m_left_event; // The event associated with the left end.
     Event *m_right_event; // The event associated with the right end
 
@@ -128,6 +137,7 @@ template<class Arrangement_, class Traits_>
     m_orig_subcurve1 (NULL),
     m_orig_subcurve2 (NULL)
       {
+        m_y_x_index = 0;
         upper_g = 0;
         lower_g = 0;
         upper = 0;
@@ -145,6 +155,8 @@ template<class Arrangement_, class Traits_>
     m_orig_subcurve1 (NULL),
     m_orig_subcurve2 (NULL)
       {
+        m_interval.set(curve.base());
+        m_y_x_index = 0;
         upper_g = 0;
         lower_g = 0;
         upper = 0;
@@ -314,6 +326,8 @@ template<class Arrangement_, class Traits_>
     void init_subcurve (const X_monotone_curve_2 &curve)
       {
         m_lastCurve = curve;
+        m_interval.set(curve.base());
+        m_y_x_index = 0;
       }
 
     /*! Destructor. */
@@ -338,6 +352,32 @@ template<class Arrangement_, class Traits_>
     void set_last_curve (const X_monotone_curve_2 &cv)
       {
         m_lastCurve = cv;
+        m_interval.set(cv.base());
+        m_y_x_index = 0;
+      }
+
+    /*! Get the double approximation of the last curve. */
+    const Interval_segment& interval_segment () const
+      {
+        return (m_interval);
+      }
+
+    /*!
+     * Bound the y-coordinate of the last curve at the x-coordinate of the
+     * current event, which has the x-index x_index and lies in x; computed
+     * once per x-index.
+     * \return false if there is no such bound.
+     */
+    bool y_at_x (unsigned int x_index, const std::pair<double, double>& x,
+        std::pair<double, double>& y) const
+      {
+        if (m_y_x_index != x_index)
+          {
+            m_y_x_index = x_index;
+            m_has_y_at_x = m_interval.y_at_x(x, m_y_at_x);
+          }
+        y = m_y_at_x;
+        return (m_has_y_at_x);
       }
 
     /*! Check if the given event is the matches the right-end event. */
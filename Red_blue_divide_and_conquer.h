@@ -1,10 +1,15 @@
 #ifndef RED_BLUE_DIVIDE_AND_CONQUER_H
 #define RED_BLUE_DIVIDE_AND_CONQUER_H
 
-#include <CGAL/Aff_transformation_2.h>
+#include "arr_types.h"
+#include <sys/time.h>
+#include <algorithm>
+#include <cstddef>
 #include "My_Sweep_line_2.h"
 #include "My_Arr_overlay_traits_2.h"
+#include "My_Arr_mirrored_traits_2.h"
 #include <CGAL/Arr_vertical_decomposition_2.h>
+#include <CGAL/Arr_batched_point_location.h>
 
 /*! \file
  * free functions for the algorithm to compute a single face of an arrangement
@@ -14,57 +19,75 @@
 CGAL_BEGIN_NAMESPACE
 
 // ---------------------------------------------------------------------------
-// Get the vertex representing point_x from an arrangement
+// Default stats sink: accumulates the wall-clock seconds spent in the phases
+// of the merge step; any class offering these members can be used instead,
+// e.g. the Qt_widget_base_tab of the demo
 //
 
-template<class Arrangement>
-typename Arrangement::Vertex_handle vertex_x(Arrangement* arr)
+struct Red_blue_stats
   {
-    MY_CGAL_DC_PRINT("begin vertex_x()");
+    double decomp_time;
+    double sweep_time;
+    double single_face_time;
 
-    typedef Arrangement Arrangement_2;
-    typedef typename Arrangement_2::Vertex_handle Vertex_handle;
-    typedef typename Arrangement_2::Face_iterator Face_iterator;
-    typedef typename Arrangement_2::Isolated_vertex_iterator Isolated_vertex_iterator;
+    //curve pairs of the sweeps rejected by the interval filter, and those
+    //passed on to the exact intersection
+    std::size_t filtered_pairs;
+    std::size_t intersected_pairs;
 
-    for(Face_iterator fit = arr->faces_begin(); fit != arr->faces_end(); fit++)
+    //times the table of intersected curve pairs outgrew its reserved size
+    std::size_t pair_table_grows;
+
+    //point locations of the mirrored sweeps in the purple arrangement
+    std::size_t purple_locates;
+
+    Red_blue_stats() :
+      decomp_time(0), sweep_time(0), single_face_time(0), filtered_pairs(0),
+      intersected_pairs(0), pair_table_grows(0), purple_locates(0)
       {
-        for(Isolated_vertex_iterator ivit = fit->isolated_vertices_begin(); ivit != fit->isolated_vertices_end(); ivit++)
-          {
-            if(ivit->data().type() == POINT_X)
-              {
-                Vertex_handle vh_x = ivit;
-                return vh_x;
-              }
-          }
       }
+  };
+
+// ---------------------------------------------------------------------------
+// Wall-clock time in seconds
+//
+
+inline double
+wall_time()
+  {
+    timeval tv;
+    gettimeofday(&tv, 0);
+    return tv.tv_sec + tv.tv_usec * 1e-6;
   }
 
 // ---------------------------------------------------------------------------
-// Do the vertical decomposition
+// Do the vertical decomposition; red_vh_x and blue_vh_x are the vertices of
+// point_x in red and blue
 //
 
 template<class Arrangement>
 void
 decompose_vertically(
-    Arrangement** red,
-    Arrangement** blue
+    Arrangement* red,
+    typename Arrangement::Vertex_handle red_vh_x,
+    Arrangement* blue,
+    typename Arrangement::Vertex_handle blue_vh_x
 )
   {
     MY_CGAL_DC_PRINT("begin decompose_vertically()");
     typedef Arrangement Arrangement_2;
     typedef typename Arrangement_2::Vertex_const_handle Vertex_const_handle;
 
-    insert_external_endpoints(red,blue);
+    insert_external_endpoints(red,red_vh_x,blue,blue_vh_x);
 
     //get a decomposition as provided by CGAL::decompose()
     std::list<std::pair<Vertex_const_handle, std::pair<Object, Object> > > red_rays;
-    decompose(*(*red),std::back_inserter(red_rays));
+    decompose(*red,std::back_inserter(red_rays));
     std::list<std::pair<Vertex_const_handle, std::pair<Object, Object> > > blue_rays;
-    decompose(*(*blue),std::back_inserter(blue_rays));
+    decompose(*blue,std::back_inserter(blue_rays));
 
-    split_edges(*red,red_rays.begin(),red_rays.end());
-    split_edges(*blue,blue_rays.begin(),blue_rays.end());
+    split_edges(red,red_rays.begin(),red_rays.end());
+    split_edges(blue,blue_rays.begin(),blue_rays.end());
   }
 
 // ---------------------------------------------------------------------------
@@ -80,23 +103,18 @@ split_edges(Arrangement* arr, Iterator begin, Iterator end)
     typedef typename Arrangement_2::Geometry_traits_2 Traits_2;
     typedef typename Traits_2::Point_2 Base_point_2;
     typedef typename Traits_2::X_monotone_curve_2 Base_x_monotone_curve_2;
-    typedef typename Traits_2::Ray_2 Ray_2;
-    typedef typename Traits_2::Segment_2 Segment_2;
 
     typedef typename Arrangement_2::Vertex_handle Vertex_handle;
 
     typedef typename Arrangement_2::Halfedge_const_handle Halfedge_const_handle;
     typedef typename Arrangement_2::Halfedge_handle Halfedge_handle;
 
-    Traits_2* traits;
+    const Traits_2* traits = arr->geometry_traits();
 
     //iterate over CGAL decomposition
     for(Iterator rit = begin; rit != end; rit++)
 
       {
-        //the vertex from which the rays were shot
-        Vertex_handle rit_first_non_const = arr->non_const_handle(rit->first);
-
         //no splitting for default vertices
         if(rit->first->data().type() == DEFAULT)
           {
@@ -137,19 +155,7 @@ split_edges(Arrangement* arr, Iterator begin, Iterator end)
             if(e != invalid_e)//ray hit an edge
 
               {
-                //find the split point
-                Base_point_2 above_or_below;
-                if( i == 1) //below
-                  {
-                    above_or_below = Base_point_2(rit->first->point().x(),(rit->first->point().y())-1);
-                  }
-                else //above
-                  {
-                    above_or_below = Base_point_2(rit->first->point().x(),(rit->first->point().y())+1);
-                  }
-                Ray_2 ray(rit->first->point(),above_or_below); //ray
                 Base_x_monotone_curve_2 curve(e->curve());//curve
-                Segment_2 seg = Segment_2(curve); //convert to segment
                 Base_point_2 intersection_base_point;
 
                 //split the edge
@@ -164,20 +170,21 @@ split_edges(Arrangement* arr, Iterator begin, Iterator end)
                   }
                 else //new strong intersection
                   {
-                    Object obj = intersection(ray,seg);
-
-                    try
-                      {
-                        intersection_base_point = object_cast<Base_point_2>(obj);
-                      }
-                    catch(Bad_object_cast)
-                      {
-                        CGAL_assertion(false);
-                      }
-
-                    //split the edge
+                    //a ray hitting the interior of an edge does not overlap
+                    //it, so the edge is not vertical and the split point is
+                    //on its supporting line at the x of the vertex
+                    CGAL_assertion(!curve.is_vertical());
+                    const Base_point_2& p = rit->first->point();
+                    intersection_base_point = Base_point_2(p.x(),curve.line().y_at_x(p.x()));
+
+                    //split the edge, both parts are pieces of its segment
+                    Halfedge_data data = e->data();
                     traits->split_2_object()(curve,intersection_base_point,sub1,sub2);
                     he_to_split_vertex = arr->split_edge(arr->non_const_handle(e),sub1,sub2);
+                    he_to_split_vertex->set_data(data);
+                    he_to_split_vertex->twin()->set_data(data);
+                    he_to_split_vertex->next()->set_data(data);
+                    he_to_split_vertex->next()->twin()->set_data(data);
                   }
 
                 //the split vertex is always DEFAULT
@@ -189,105 +196,392 @@ split_edges(Arrangement* arr, Iterator begin, Iterator end)
   }
 
 // ---------------------------------------------------------------------------
-// Insert endpoints as external endpoints in arrangement of other color
+// Collect the original endpoints on the boundary of the face containing
+// point_x, each once; the arrangement may contain other faces as well
 //
 
 template<typename Arrangement>
 void
-insert_external_endpoints(Arrangement** red, Arrangement** blue)
+face_x_endpoints(Arrangement* arr,
+    typename Arrangement::Vertex_handle vh_x,
+    std::vector<typename Arrangement::Point_2>& endpoints)
   {
-    MY_CGAL_DC_PRINT("begin insert_external_endpoints()");
+    MY_CGAL_DC_PRINT("begin face_x_endpoints()");
     typedef Arrangement Arrangement_2;
-    typedef typename Traits_2::Point_2 Base_point_2;
-    typedef typename Arrangement_2::Vertex_iterator Vertex_iterator;
-    typedef typename Arrangement_2::Isolated_vertex_iterator Isolated_vertex_iterator;
-    typedef typename Arrangement_2::Face_iterator Face_iterator;
+    typedef typename Arrangement_2::Vertex Vertex;
     typedef typename Arrangement_2::Face_handle Face_handle;
+    typedef typename Arrangement_2::Inner_ccb_iterator Inner_ccb_iterator;
+    typedef typename Arrangement_2::Ccb_halfedge_circulator Ccb_halfedge_circulator;
 
-    std::vector<Base_point_2> red_endpoints;
+    Face_handle fh_x = vh_x->face();
 
-    //extract red endpoints
-    for (Vertex_iterator vit = (*red)->vertices_begin(); vit != (*red)->vertices_end(); ++vit)
+    //a vertex may be visited several times along the ccbs
+    std::set<const Vertex*> visited;
+
+    for (Inner_ccb_iterator hole = fh_x->holes_begin(); hole != fh_x->holes_end(); ++hole)
       {
-        if(vit->data().type() == INTERNAL_ENDPOINT)
+        Ccb_halfedge_circulator curr = *hole;
+        do
+          {
+            if(curr->target()->data().type() == INTERNAL_ENDPOINT
+                && visited.insert(&(*(curr->target()))).second)
+              {
+                endpoints.push_back(curr->target()->point());
+              }
+            curr++;
+          }while(curr != *hole);
+      }
+
+    if(!(fh_x->is_unbounded()))
+      {
+        Ccb_halfedge_circulator curr = fh_x->outer_ccb();
+        do
           {
-            red_endpoints.push_back(vit->point());
+            if(curr->target()->data().type() == INTERNAL_ENDPOINT
+                && visited.insert(&(*(curr->target()))).second)
+              {
+                endpoints.push_back(curr->target()->point());
+              }
+            curr++;
+          }while(curr != fh_x->outer_ccb());
+      }
+  }
+
+// ---------------------------------------------------------------------------
+// Remove the edges and the isolated vertices of arr that are not on the
+// boundary of the face containing point_x, in place; that face and vh_x, the
+// vertex of point_x, stay valid
+//
+
+template<typename Arrangement>
+void
+remove_other_faces(Arrangement* arr,
+    typename Arrangement::Vertex_handle vh_x)
+  {
+    MY_CGAL_DC_PRINT("begin remove_other_faces()");
+    typedef Arrangement Arrangement_2;
+    typedef typename Arrangement_2::Vertex_handle Vertex_handle;
+    typedef typename Arrangement_2::Halfedge_handle Halfedge_handle;
+    typedef typename Arrangement_2::Face_handle Face_handle;
+    typedef typename Arrangement_2::Vertex_iterator Vertex_iterator;
+    typedef typename Arrangement_2::Edge_iterator Edge_iterator;
+
+    Face_handle fh_x = vh_x->face();
+
+    //collect the edges first, removing them invalidates the iterators
+    std::vector<Halfedge_handle> edges;
+    for(Edge_iterator eit = arr->edges_begin(); eit != arr->edges_end(); eit++)
+      {
+        if(eit->face() != fh_x && eit->twin()->face() != fh_x)
+          {
+            edges.push_back(eit);
           }
       }
-    std::vector<Base_point_2> blue_endpoints;
 
-    //extract blue endpoints
-    for (Vertex_iterator vit = (*blue)->vertices_begin(); vit != (*blue)->vertices_end(); vit++)
+    //an edge between two other faces merges them, so fh_x is never removed;
+    //an endpoint goes with its last edge
+    for(unsigned int i = 0; i < edges.size(); i++)
+      {
+        arr->remove_edge(edges[i]);
+      }
+
+    //the isolated vertices left are point_x, former external endpoints and
+    //eagerly inserted purple vertices without edges
+    std::vector<Vertex_handle> isolated;
+    for(Vertex_iterator vit = arr->vertices_begin(); vit != arr->vertices_end(); vit++)
       {
-        if(vit->data().type() == INTERNAL_ENDPOINT)
+        Vertex_handle vh = vit;
+        if(vh->is_isolated() && vh != vh_x)
           {
-            blue_endpoints.push_back(vit->point());
+            isolated.push_back(vh);
           }
       }
+    for(unsigned int i = 0; i < isolated.size(); i++)
+      {
+        arr->remove_isolated_vertex(isolated[i]);
+      }
+  }
+
+// ---------------------------------------------------------------------------
+// Keep the points in the interior of the face containing point_x, located by
+// one batched point location sweep over the arrangement; after
+// remove_other_faces() that sweep only meets the boundary of this face
+//
+
+template<typename Arrangement>
+void
+locate_in_face_x(Arrangement* arr,
+    typename Arrangement::Vertex_handle vh_x,
+    std::vector<typename Arrangement::Point_2>& points)
+  {
+    MY_CGAL_DC_PRINT("begin locate_in_face_x()");
+    typedef Arrangement Arrangement_2;
+    typedef typename Arrangement_2::Point_2 Point_2;
+    typedef typename Arrangement_2::Face_const_handle Face_const_handle;
 
-    //employ adapted single face function to insert the endpoints
-    Arrangement_2* red_ext = single_face(*red,&blue_endpoints);
-    Arrangement_2* blue_ext = single_face(*blue,&red_endpoints);
+    std::list<std::pair<Point_2, Object> > located;
+    locate(*arr,points.begin(),points.end(),std::back_inserter(located));
 
-    Face_handle red_fh_x = (vertex_x(red_ext))->face();
-    Face_handle blue_fh_x = (vertex_x(blue_ext))->face();
+    Face_const_handle fh_x = vh_x->face();
+    points.clear();
 
-    //remove endpoints that are not contained in the face containing point_x
-    for(Face_iterator fit = blue_ext->faces_begin(); fit != blue_ext->faces_end(); fit++)
+    typename std::list<std::pair<Point_2, Object> >::iterator lit;
+    for(lit = located.begin(); lit != located.end(); lit++)
       {
-        for (Isolated_vertex_iterator ivit = fit->isolated_vertices_begin(); ivit != fit->isolated_vertices_end();)
+        Face_const_handle fh;
+        if(CGAL::assign(fh,lit->second) && fh == fh_x)
           {
-            Isolated_vertex_iterator next = ivit;
-            next++;
-            if(ivit->data().type() == EXTERNAL_ENDPOINT)
+            points.push_back(lit->first);
+          }
+      }
+  }
+
+// ---------------------------------------------------------------------------
+// Insert the located points as isolated external endpoints into the face
+// containing point_x
+//
+
+template<typename Arrangement>
+void
+insert_in_face_x(Arrangement* arr,
+    typename Arrangement::Vertex_handle vh_x,
+    const std::vector<typename Arrangement::Point_2>& points)
+  {
+    typedef typename Arrangement::Vertex_handle Vertex_handle;
+
+    for(unsigned int i = 0; i < points.size(); i++)
+      {
+        Vertex_handle vh = arr->insert_in_face_interior(points[i],vh_x->face());
+        vh->set_data(EXTERNAL_ENDPOINT);
+      }
+  }
+
+// ---------------------------------------------------------------------------
+// Reduce red and blue to the faces containing point_x and insert the
+// endpoints of each as external endpoints into the other, in place;
+// red_vh_x and blue_vh_x are the vertices of point_x
+//
+
+template<typename Arrangement>
+void
+insert_external_endpoints(Arrangement* red,
+    typename Arrangement::Vertex_handle red_vh_x,
+    Arrangement* blue,
+    typename Arrangement::Vertex_handle blue_vh_x)
+  {
+    MY_CGAL_DC_PRINT("begin insert_external_endpoints()");
+    typedef Arrangement Arrangement_2;
+    typedef typename Arrangement_2::Point_2 Base_point_2;
+
+    //the results of the last merges still contain their other faces
+    remove_other_faces(red,red_vh_x);
+    remove_other_faces(blue,blue_vh_x);
+
+    //extract the endpoints on the boundary of the faces containing point_x
+    std::vector<Base_point_2> red_endpoints;
+    face_x_endpoints(red,red_vh_x,red_endpoints);
+    std::vector<Base_point_2> blue_endpoints;
+    face_x_endpoints(blue,blue_vh_x,blue_endpoints);
+
+    //keep only the endpoints inside the face containing point_x of the
+    //arrangement of the other color
+    locate_in_face_x(red,red_vh_x,blue_endpoints);
+    locate_in_face_x(blue,blue_vh_x,red_endpoints);
+
+    insert_in_face_x(red,red_vh_x,blue_endpoints);
+    insert_in_face_x(blue,blue_vh_x,red_endpoints);
+  }
+// ---------------------------------------------------------------------------
+// Order vertex handles by their points, xy-lexicographically
+//
+
+template<typename Vertex_handle>
+struct Less_vertex_xy
+  {
+    bool
+    operator()(Vertex_handle v1, Vertex_handle v2) const
+      {
+        return v1->point() < v2->point();
+      }
+  };
+
+// ---------------------------------------------------------------------------
+// Insert the red and blue vertices into the purple arrangement, once for both
+// sweeps; a red and a blue vertex at the same point become one purple vertex.
+// The red and the blue vertices are sorted by their points and merged, and
+// every one stores the index of its point in this xy order and the handle of
+// its purple vertex. With lazy_vertices only point_x is inserted, the other
+// purple vertices are created by the sweeps and looked up in lazy_vertices
+// by the red vertex at their point, or the blue one if there is none; the
+// red and blue vertices then store no purple vertex. Returns the number of
+// points; purple_vh_x is set to the purple vertex of point_x
+//
+
+template<typename Arrangement>
+unsigned int
+insert_purple_vertices(Arrangement* red, Arrangement* blue, Arrangement* purple,
+    typename Arrangement::Vertex_handle& purple_vh_x,
+    std::map<const typename Arrangement::Vertex*,
+        typename Arrangement::Vertex_handle>* lazy_vertices = 0)
+  {
+    MY_CGAL_DC_PRINT("begin insert_purple_vertices()");
+    typedef Arrangement Arrangement_2;
+    typedef typename Arrangement_2::Geometry_traits_2 Traits_2;
+
+    typedef typename Arrangement_2::Vertex_iterator Vertex_iterator;
+    typedef typename Arrangement_2::Vertex_handle Vertex_handle;
+    typedef typename Arrangement_2::Vertex_const_handle Vertex_const_handle;
+
+    typedef My_Arr_overlay_traits_2<Traits_2, Arrangement_2, Arrangement_2> Meta_traits_2;
+    typedef typename Meta_traits_2::Point_2 Point_2;
+
+    //sort the red and the blue vertices by their points
+    std::vector<Vertex_handle> red_vertices;
+    red_vertices.reserve(red->number_of_vertices());
+    for(Vertex_iterator vit = red->vertices_begin(); vit != red->vertices_end(); vit++)
+      {
+        red_vertices.push_back(vit);
+      }
+    std::sort(red_vertices.begin(), red_vertices.end(),
+        Less_vertex_xy<Vertex_handle>());
+
+    std::vector<Vertex_handle> blue_vertices;
+    blue_vertices.reserve(blue->number_of_vertices());
+    for(Vertex_iterator vit = blue->vertices_begin(); vit != blue->vertices_end(); vit++)
+      {
+        blue_vertices.push_back(vit);
+      }
+    std::sort(blue_vertices.begin(), blue_vertices.end(),
+        Less_vertex_xy<Vertex_handle>());
+
+    //merge them into one meta point per point; a blue vertex at the point of
+    //a red one is only added to its meta point if it is not of type DEFAULT
+    std::vector<Point_2> points;
+    points.reserve(red_vertices.size() + blue_vertices.size());
+    Vertex_const_handle empty_vh;
+    unsigned int r = 0, b = 0;
+    while(r < red_vertices.size() || b < blue_vertices.size())
+      {
+        bool take_red = (b == blue_vertices.size()) || (r < red_vertices.size()
+            && !(blue_vertices[b]->point() < red_vertices[r]->point()));
+        bool take_blue = (r == red_vertices.size()) || (b < blue_vertices.size()
+            && !(red_vertices[r]->point() < blue_vertices[b]->point()));
+
+        if(take_red)
+          {
+            Vertex_const_handle vch = red_vertices[r];
+            points.push_back(Point_2 (vch->point(),vch,empty_vh));
+            red_vertices[r]->data().set_index(points.size() - 1);
+            r++;
+          }
+        if(take_blue)
+          {
+            Vertex_const_handle vch = blue_vertices[b];
+            if(!take_red)
               {
-                if(ivit->face() != blue_fh_x)
-                  {
-                     blue_ext->remove_isolated_vertex(ivit);
-                  }
+                points.push_back(Point_2 (vch->point(),empty_vh,vch));
+              }
+            else if(vch->data().type() != DEFAULT)
+              {
+                points.back().set_blue_vertex_handle(vch);
               }
-            ivit = next;
+            blue_vertices[b]->data().set_index(points.size() - 1);
+            b++;
           }
       }
 
-    for(Face_iterator fit = red_ext->faces_begin(); fit != red_ext->faces_end(); fit++)
+    //insert the purple vertices, or only point_x
+    for(unsigned int i = 0; i < points.size(); i++)
       {
-        for (Isolated_vertex_iterator ivit = fit->isolated_vertices_begin(); ivit != fit->isolated_vertices_end();)
+        if(lazy_vertices != 0 && points[i].purple_data() != POINT_X)
           {
-            Isolated_vertex_iterator next = ivit;
-            next++;
-            if(ivit->data().type() == EXTERNAL_ENDPOINT)
-              {
+            continue;
+          }
 
-                if(ivit->face() != red_fh_x)
-                  {
-                    red_ext->remove_isolated_vertex(ivit);
-                  }
-              }
-            ivit = next;
+        Vertex_handle vh = purple->insert_in_face_interior(points[i].base(),purple->unbounded_face());
+        vh->set_data(points[i].purple_data());
+        if(points[i].purple_data() == POINT_X)
+          {
+            purple_vh_x = vh;
+          }
+        if(lazy_vertices != 0)
+          {
+            Vertex_const_handle key_vh = points[i].is_red_vertex_empty() ?
+                points[i].blue_vertex_handle() : points[i].red_vertex_handle();
+            lazy_vertices->insert(std::make_pair(&(*key_vh),vh));
+          }
+        else
+          {
+            points[i].set_purple_vertex_handle(vh);
           }
       }
 
-    delete (*red);
-    delete (*blue);
-    *red = red_ext;
-    *blue = blue_ext;
+    if(lazy_vertices != 0)
+      {
+        return points.size();
+      }
+
+    //let the red and blue vertices know their purple vertex
+    for(r = 0; r < red_vertices.size(); r++)
+      {
+        red_vertices[r]->data().set_vertex_handle(purple->non_const_handle(
+            points[red_vertices[r]->data().index()].purple_vertex_handle()));
+      }
+    for(b = 0; b < blue_vertices.size(); b++)
+      {
+        blue_vertices[b]->data().set_vertex_handle(purple->non_const_handle(
+            points[blue_vertices[b]->data().index()].purple_vertex_handle()));
+      }
+
+    return points.size();
   }
+
 // ---------------------------------------------------------------------------
-// Left right sweep over the points and curves of the red and blue arrangements
+// The map of the purple vertices created by the sweeps on demand if
+// MY_CGAL_DC_LAZY_PURPLE_VERTICES asks for it, or none, so that all red and
+// blue vertices are inserted before the sweeps
 //
 
-template<typename Arrangement>
-Arrangement*
-prepare_and_sweep(Arrangement* red, Arrangement* blue)
+template<typename Purple_vertex_map>
+Purple_vertex_map*
+lazy_purple_vertices(Purple_vertex_map& vertices)
+  {
+#ifdef MY_CGAL_DC_LAZY_PURPLE_VERTICES
+    return &vertices;
+#else
+    return 0;
+#endif
+  }
+
+// ---------------------------------------------------------------------------
+// Sweep over the points and curves of the red and blue arrangements into the
+// purple arrangement, from left to right with the geometry traits of the
+// arrangements or from right to left with these traits wrapped by
+// Arr_mirrored_traits_2. The purple vertices have to be inserted by
+// insert_purple_vertices() before, with the same lazy_vertices; the vertices
+// know the index of their point from there, number_of_points is its result.
+// Both sweeps of a merge share purple and intersections, so every vertex and
+// edge is created once, and memo, so every crossing of a red and a blue
+// input segment is constructed once. The counts of the interval filter of
+// the sweep are added to stats
+//
+
+template<typename Arrangement, typename Intersection_vertex_map, typename Sweep_traits, typename Stats>
+void
+prepare_and_sweep(Arrangement* red, Arrangement* blue, Arrangement* purple,
+    Intersection_vertex_map* intersections,
+    Intersection_memo<typename Arrangement::Point_2>* memo,
+    const Sweep_traits& sweep_traits,
+    unsigned int number_of_points,
+    Stats& stats,
+    std::map<const typename Arrangement::Vertex*,
+        typename Arrangement::Vertex_handle>* lazy_vertices = 0)
   {
     MY_CGAL_DC_PRINT("begin prepare_and_sweep()");
     typedef Arrangement Arrangement_2;
-    typedef typename Arrangement_2::Geometry_traits_2 Traits_2;
-    typedef typename Traits_2::Point_2 Base_point_2;
+    typedef Sweep_traits Traits_2;
 
     typedef typename Arrangement_2::Vertex_const_iterator Vertex_const_iterator;
-    typedef typename Arrangement_2::Vertex_handle Vertex_handle;
     typedef typename Arrangement_2::Edge_iterator Edge_iterator;
     typedef typename Arrangement_2::Vertex_const_handle Vertex_const_handle;
     typedef typename Arrangement_2::Halfedge_handle Halfedge_handle;
@@ -298,65 +592,49 @@ prepare_and_sweep(Arrangement* red, Arrangement* blue)
     typedef My_Sweep_line_2<Arrangement_2,Meta_traits_2> Sweep_line;
 
     //initialize sweep line with the meta traits
-    Meta_traits_2 meta_traits (*(red->geometry_traits()));
+    Meta_traits_2 meta_traits (sweep_traits);
+    meta_traits.set_intersection_memo(memo);
     Sweep_line* sweep_line = new Sweep_line(&meta_traits);
+    sweep_line->set_purple(purple, intersections, lazy_vertices);
 
-    //map the points to avoid duplication of meta points
-    std::map<Base_point_2, Point_2> points_map;
-    typename std::map<Base_point_2, Point_2>::iterator ppit;
-    Object empty_obj;
+    //one meta point per point, at the index insert_purple_vertices() gave
+    //its vertices; without lazy_vertices, it knows the purple vertex already
+    std::vector<Point_2> points_vector (number_of_points);
+    Vertex_const_handle empty_vh;
 
     //initialize red meta points
     for(Vertex_const_iterator vit = red->vertices_begin(); vit != red->vertices_end(); vit++)
       {
         Vertex_const_handle vch = vit;
-        Point_2 meta_point = Point_2 (vch->point(),CGAL::make_object(vch),empty_obj);
-        std::pair<Base_point_2, Point_2> p_pair = std::pair<Base_point_2, Point_2>(meta_point.base(),meta_point);
-        points_map.insert(p_pair);
+        Point_2& meta_point = points_vector[vit->data().index()];
+        meta_point = Point_2 (vch->point(),vch,empty_vh);
+        if(lazy_vertices == 0)
+          {
+            meta_point.set_purple_vertex_handle(vit->data().vertex_handle());
+          }
       }
 
     //initialize blue meta points, some may already exist and just need to be updated
     for(Vertex_const_iterator vit = blue->vertices_begin(); vit != blue->vertices_end(); vit++)
       {
         Vertex_const_handle vch = vit;
-        Point_2 meta_point = Point_2 (vch->point(),empty_obj,CGAL::make_object(vch));
-        std::pair<Base_point_2, Point_2> pair = std::pair<Base_point_2, Point_2>(meta_point.base(),meta_point);
-
-        if((vit->data().type() != DEFAULT))
+        Point_2& meta_point = points_vector[vit->data().index()];
+        if(meta_point.is_red_vertex_empty())
           {
-            ppit = points_map.find(meta_point.base());
-
-            if(ppit != points_map.end())
-              {
-                ppit->second.set_blue_object(CGAL::make_object(vch));
-              }
-            else
+            meta_point = Point_2 (vch->point(),empty_vh,vch);
+            if(lazy_vertices == 0)
               {
-                points_map.insert(pair);
+                meta_point.set_purple_vertex_handle(vit->data().vertex_handle());
               }
           }
-        else
+        else if(vit->data().type() != DEFAULT)
           {
-
-            points_map.insert(pair);
+            meta_point.set_blue_vertex_handle(vch);
           }
       }
 
-    //insert all red and blue vertices into the purple arrangement and put the points in a vector,
-    //store the purple vertex with the meta point
-    Arrangement_2* purple = sweep_line->get_purple();
-    std::vector<Point_2> points_vector;
-
-    for(ppit = points_map.begin(); ppit != points_map.end(); ppit++)
-      {
-        Vertex_const_handle vh = purple->insert_in_face_interior(ppit->first,purple->unbounded_face());
-        Vertex_handle non_const_vh = purple->non_const_handle(vh);
-        non_const_vh->set_data(ppit->second.purple_data());
-        ppit->second.set_purple_object(CGAL::make_object(vh));
-        points_vector.push_back(ppit->second);
-      }
-
-    //initialize the meta traits red curves and put them in a vector
+    //initialize the meta traits red curves and put them in a vector; their
+    //halfedges are directed against the sweep, so the source is the right end
     Halfedge_handle he, invalid_he;
     std::vector<X_monotone_curve_2> red_xcurves_vec (red->number_of_edges());
     unsigned int i = 0;
@@ -364,16 +642,16 @@ prepare_and_sweep(Arrangement* red, Arrangement* blue)
     for (eit = red->edges_begin(); eit != red->edges_end(); ++eit, i++)
       {
         he = eit;
-        if (he->direction() != ARR_RIGHT_TO_LEFT)
+        if (he->direction() != Sweep_halfedge_direction<Traits_2>::value)
           {
             he = he->twin();
           }
 
         red_xcurves_vec[i] = X_monotone_curve_2 (eit->curve(),he,invalid_he);
-        ppit = points_map.find(he->source()->point());
-        red_xcurves_vec[i].set_right_ex_point(ppit->second);
-        ppit = points_map.find(he->target()->point());
-        red_xcurves_vec[i].set_left_ex_point(ppit->second);
+        red_xcurves_vec[i].set_right_ex_point(
+            points_vector[he->source()->data().index()]);
+        red_xcurves_vec[i].set_left_ex_point(
+            points_vector[he->target()->data().index()]);
       }
 
     //initialize the meta traits blue curves and put them in a vector
@@ -382,40 +660,53 @@ prepare_and_sweep(Arrangement* red, Arrangement* blue)
     for (eit = blue->edges_begin(); eit != blue->edges_end(); ++eit, i++)
       {
         he = eit;
-        if (he->direction() != ARR_RIGHT_TO_LEFT)
+        if (he->direction() != Sweep_halfedge_direction<Traits_2>::value)
           {
 
             he = he->twin();
           }
 
         blue_xcurves_vec[i] = X_monotone_curve_2 (eit->curve(),invalid_he,he);
-        ppit = points_map.find(he->source()->point());
-        blue_xcurves_vec[i].set_right_ex_point(ppit->second);
-        ppit = points_map.find(he->target()->point());
-        blue_xcurves_vec[i].set_left_ex_point(ppit->second);
+        blue_xcurves_vec[i].set_right_ex_point(
+            points_vector[he->source()->data().index()]);
+        blue_xcurves_vec[i].set_left_ex_point(
+            points_vector[he->target()->data().index()]);
+      }
+
+    //the meta points are in xy order, so that the event queue is built
+    //without comparisons; the mirrored sweep takes them backwards
+    if (Sweep_halfedge_direction<Traits_2>::value != ARR_RIGHT_TO_LEFT)
+      {
+        std::reverse(points_vector.begin(), points_vector.end());
       }
 
     //do the sweep
-    sweep_line->sweep (red_xcurves_vec.begin(),
+    sweep_line->sweep_sorted (red_xcurves_vec.begin(),
         red_xcurves_vec.end(),
         blue_xcurves_vec.begin(),
         blue_xcurves_vec.end(),
         points_vector.begin(),
         points_vector.end());
 
+    stats.filtered_pairs += sweep_line->filtered_pairs();
+    stats.intersected_pairs += sweep_line->intersected_pairs();
+    stats.pair_table_grows += sweep_line->pair_table_grows();
+    stats.purple_locates += sweep_line->purple_locates();
     delete sweep_line;
-    return purple;
   }
 
 // ---------------------------------------------------------------------------
-// Construct a singleton arrangement
+// Construct a singleton arrangement of the input segment with the index
+// segment; vh_x is set to the vertex of point_x
 //
 
 template<class Arrangement>
 Arrangement*
 singleton_arrangement(
     typename Arrangement::X_monotone_curve_2 curve,
-    typename Arrangement::Point_2 point_x
+    unsigned int segment,
+    typename Arrangement::Point_2 point_x,
+    typename Arrangement::Vertex_handle& vh_x
 )
   {
     MY_CGAL_DC_PRINT("begin singleton_arrangement()");
@@ -428,7 +719,7 @@ singleton_arrangement(
     Face_handle uf = singleton->unbounded_face();
 
     //insert point_x
-    Vertex_handle vh_x = singleton->insert_in_face_interior(point_x, uf);
+    vh_x = singleton->insert_in_face_interior(point_x, uf);
     vh_x->set_data(POINT_X);
 
     //insert the left endpoint of the curve
@@ -440,23 +731,32 @@ singleton_arrangement(
     vh_right->set_data(INTERNAL_ENDPOINT);
 
     //insert the curve
-    singleton->insert_at_vertices(curve,vh_left,vh_right);
+    typename Arrangement_2::Halfedge_handle he =
+        singleton->insert_at_vertices(curve,vh_left,vh_right);
+    he->set_data(Halfedge_data(segment));
+    he->twin()->set_data(Halfedge_data(segment));
 
     return singleton;
   }
 
 // ---------------------------------------------------------------------------
-// The recursive function to start the single face computation
+// The recursive function of the single face computation; the arrangement
+// returned contains the face containing point_x, which is extracted by the
+// next merge or by extract_face_x(); vh_x is set to the vertex of point_x,
+// so that no stage has to search for it, and stays invalid without curves.
+// The curves are the input segments from the index first on
 //
 
-template<class Arrangement, class Iterator>
+template<class Arrangement, class Iterator, class Stats>
 Arrangement*
-red_blue_divide_and_conquer(
+red_blue_recursion(
     Iterator begin, Iterator end,
+    unsigned int first,
     typename Arrangement::Point_2 point_x,
-    typename Arrangement::Point_2 pivot)
+    typename Arrangement::Vertex_handle& vh_x,
+    Stats& stats)
   {
-    MY_CGAL_DC_PRINT("begin red_blue_divide_and_conquer");
+    MY_CGAL_DC_PRINT("begin red_blue_recursion");
 
     //arrangement to return
     Arrangement* purple;
@@ -474,7 +774,7 @@ red_blue_divide_and_conquer(
     //one curve
     if (iter == end)
       {
-        purple = singleton_arrangement<Arrangement>(*begin, point_x);
+        purple = singleton_arrangement<Arrangement>(*begin, first, point_x, vh_x);
       }
     //more than one curve
 
@@ -495,272 +795,165 @@ red_blue_divide_and_conquer(
           }
 
         //continue recursively
-        Arrangement* red = red_blue_divide_and_conquer<Arrangement>(begin, div_it, point_x, pivot);
-        Arrangement* blue = red_blue_divide_and_conquer<Arrangement>(div_it, end, point_x, pivot);
+        typename Arrangement::Vertex_handle red_vh_x, blue_vh_x;
+        unsigned int blue_first = first + (count + 1) / 2;
+        Arrangement* red = red_blue_recursion<Arrangement>(begin, div_it, first, point_x, red_vh_x, stats);
+        Arrangement* blue = red_blue_recursion<Arrangement>(div_it, end, blue_first, point_x, blue_vh_x, stats);
 
         //merge red and blue
-        purple = red_blue_merge(red, blue, pivot);
+        purple = red_blue_merge(red, red_vh_x, blue, blue_vh_x, vh_x, stats);
       }
     return purple;
   }
 
 // ---------------------------------------------------------------------------
-// Merge a red and a blue face into a purple one
+// Replace the result of the recursion by the single face containing point_x,
+// given its vertex vh_x
 //
-template<class Arrangement>
+
+template<class Arrangement, class Stats>
 Arrangement*
-red_blue_merge(
-    Arrangement* red,
-    Arrangement* blue,
-    typename Arrangement::Point_2 pivot
-)
+extract_face_x(Arrangement* purple,
+    typename Arrangement::Vertex_handle vh_x,
+    Stats& stats)
   {
-    MY_CGAL_DC_PRINT("begin red_blue_merge()");
-    typedef Arrangement Arrangement_2;
-
-    QWidget* qw = qApp->mainWidget();
-    QMainWindow* qmw = static_cast<QMainWindow*> (qw);
-    QTabWidget* qtw = static_cast<QTabWidget*> (qmw->centralWidget());
-    Qt_widget_base_tab* base = static_cast<Qt_widget_base_tab*> (qtw->currentPage());
-
-
-    clock_t t1,t2;
-    t1 = clock();
-
-    //compute the vertical decompositions of both arrangements
-    decompose_vertically(&red,&blue);
-
-    t2 = clock();
-    double decomp_time = double(t2 - t1);
-    base->decomp_time += decomp_time;
-
-    //sweep from left to right
-    Arrangement_2* purple = prepare_and_sweep(red,blue);
-
-    t1 = clock();
-    double sweep_time = double(t1-t2);
-    base->sweep_time += sweep_time;
-
-    //rotate both arrangements
-    Arrangement_2* red_rotated = rotate(red,pivot);
-    Arrangement_2* blue_rotated = rotate(blue,pivot);
-    delete red;
-    red = 0;
-    delete blue;
-    blue = 0;
-
-    t2 = clock();
-    double rotate_time = double(t2-t1);
-    base->rotate_time += rotate_time;
-
-    //equivalent to sweep from right to left
-    Arrangement_2* purple_rotated = prepare_and_sweep(red_rotated,blue_rotated);
-    delete red_rotated;
-    red_rotated = 0;
-    delete blue_rotated;
-    blue_rotated = 0;
+    MY_CGAL_DC_PRINT("begin extract_face_x()");
 
-    t1 = clock();
-    sweep_time = double(t1-t2);
-    base->sweep_time += sweep_time;
-
-    //undo rotation and fuse the results of the two sweeps
-    Arrangement_2* purple_rotated_back = rotate(purple_rotated,pivot);
-
-    t2 = clock();
-    rotate_time = double(t2-t1);
-    base->rotate_time += rotate_time;
+    //no curves, no point_x
+    if (purple->number_of_vertices() == 0)
+      {
+        return purple;
+      }
 
-    Arrangement_2* purple_fused = fuse(purple, purple_rotated_back);
+    double t1,t2;
+    t1 = wall_time();
 
+    Arrangement* purple_single_face = single_face(purple, vh_x);
     delete purple;
     purple = 0;
-    delete purple_rotated;
-    purple_rotated = 0;
-    delete purple_rotated_back;
-    purple_rotated_back = 0;
 
-    t1 = clock();
-    double fuse_time = double(t1-t2);
-    base->fuse_time += fuse_time;
-
-    //extract the single face containing POINT_X
-    Arrangement_2* purple_single_face = single_face(purple_fused);
-    delete purple_fused;
-    purple_fused = 0;
+    t2 = wall_time();
+    stats.single_face_time += t2 - t1;
 
     return purple_single_face;
   }
 
 // ---------------------------------------------------------------------------
-// Rotate an arrangement around pivot
+// Start the single face computation
 //
 
-template<class Arrangement>
+template<class Arrangement, class Iterator, class Stats>
 Arrangement*
-rotate(Arrangement* arr, typename Arrangement::Point_2 pivot)
+red_blue_divide_and_conquer(
+    Iterator begin, Iterator end,
+    typename Arrangement::Point_2 point_x,
+    Stats& stats)
   {
-    MY_CGAL_DC_PRINT("begin rotate()");
-
-    typedef Arrangement Arrangement_2;
-    typedef typename Arrangement_2::Face_handle Face_handle;
-    typedef typename Arrangement_2::Vertex_handle Vertex_handle;
-    typedef typename Arrangement_2::Vertex_iterator Vertex_iterator;
-    typedef typename Arrangement_2::Edge_iterator Edge_iterator;
-    typedef typename Arrangement_2::Point_2 Point_2;
-    typedef typename Arrangement_2::X_monotone_curve_2 X_monotone_curve_2;
-    typedef Aff_transformation_2<Kernel> Aff_transformation_2;
-
-    //will contain the rotated arrangement
-    Arrangement_2* rotated = new Arrangement_2();
-
-    //three matrices
-    Aff_transformation_2 translate(1,0,-(pivot.x()),0,1,-(pivot.y()));
-    Aff_transformation_2 rot(-1,0,0,0,-1,0);
-    Aff_transformation_2 translate_back(1,0,pivot.x(),0,1,pivot.y());
-
-    Face_handle uf = rotated->unbounded_face();
-
-    for(Vertex_iterator vit = arr->vertices_begin(); vit != arr->vertices_end(); vit++)
-      {
-        //translate and rotate the point
-        Point_2 rot_point = translate(vit->point());
-        rot_point = rot(rot_point);
-        rot_point = translate_back(rot_point);
-
-        //insert in the new arrangement and memorize the new handle
-        Vertex_handle vh = rotated->insert_in_face_interior(rot_point,uf);
-        vh->set_data(vit->data());
-        vit->data().set_vertex_handle(vh);
-      }
-
-    for(Edge_iterator ch = arr->edges_begin(); ch != arr->edges_end(); ch++)
-      {
-        //get the new handles and insert the curve
-        Vertex_handle vh_source = ch->source()->data().vertex_handle();
-        Vertex_handle vh_target = ch->target()->data().vertex_handle();
-
-        X_monotone_curve_2 curve = X_monotone_curve_2(vh_source->point(),vh_target->point());
-        rotated->insert_at_vertices(curve,vh_source,vh_target);
-
-      }
+    MY_CGAL_DC_PRINT("begin red_blue_divide_and_conquer");
 
-    return rotated;
+    typename Arrangement::Vertex_handle vh_x;
+    Arrangement* purple = red_blue_recursion<Arrangement>(begin, end, 0, point_x, vh_x, stats);
+    return extract_face_x(purple, vh_x, stats);
   }
 
 // ---------------------------------------------------------------------------
-// Fuse two arrangements into one
+// Start the single face computation without collecting statistics
 //
 
-template<class Arrangement>
-Arrangement* fuse(Arrangement* first, Arrangement* second)
+template<class Arrangement, class Iterator>
+Arrangement*
+red_blue_divide_and_conquer(
+    Iterator begin, Iterator end,
+    typename Arrangement::Point_2 point_x)
   {
-    MY_CGAL_DC_PRINT("begin fuse()");
+    Red_blue_stats stats;
+    return red_blue_divide_and_conquer<Arrangement>(begin, end, point_x, stats);
+  }
 
+// ---------------------------------------------------------------------------
+// Merge a red and a blue face into a purple one; the purple arrangement is
+// returned as the sweeps left it, the next merge removes its other faces in
+// place and extract_face_x() copies the face containing point_x out at last.
+// red_vh_x and blue_vh_x are the vertices of point_x in red and blue,
+// purple_vh_x is set to the one in purple
+//
+template<class Arrangement, class Stats>
+Arrangement*
+red_blue_merge(
+    Arrangement* red,
+    typename Arrangement::Vertex_handle red_vh_x,
+    Arrangement* blue,
+    typename Arrangement::Vertex_handle blue_vh_x,
+    typename Arrangement::Vertex_handle& purple_vh_x,
+    Stats& stats
+)
+  {
+    MY_CGAL_DC_PRINT("begin red_blue_merge()");
     typedef Arrangement Arrangement_2;
-    typedef typename Arrangement_2::Face_handle Face_handle;
-    typedef typename Arrangement_2::Vertex_handle Vertex_handle;
-    typedef typename Arrangement_2::Vertex_iterator Vertex_iterator;
-    typedef typename Arrangement_2::Edge_iterator Edge_iterator;
-    typedef typename Arrangement_2::Point_2 Point_2;
-    typedef typename Arrangement_2::X_monotone_curve_2 X_monotone_curve_2;
-
-    Arrangement_2* fused = new Arrangement_2();
-    Face_handle uf = fused->unbounded_face();
-
-    //map the inserted points to their handles to avoid redundant insertions
-    std::map<Point_2, Vertex_handle> points_map;
-    typename std::map<Point_2, Vertex_handle>::iterator pm_it;
-
-    //insert all vertices from the first arrangement
-    for(Vertex_iterator vit = first->vertices_begin(); vit != first->vertices_end(); vit++)
-      {
-        Vertex_handle vh = fused->insert_in_face_interior(vit->point(),uf);
-        vh->set_data(vit->data());
-        points_map.insert(std::make_pair(vit->point(),vh));
-      }
+    typedef typename Arrangement_2::Geometry_traits_2 Traits_2;
+    typedef My_Arr_overlay_traits_2<Traits_2, Arrangement_2, Arrangement_2> Meta_traits_2;
+    typedef typename My_Sweep_line_2<Arrangement_2,Meta_traits_2>::Intersection_vertex_map Intersection_vertex_map;
+    typedef typename My_Sweep_line_2<Arrangement_2,Meta_traits_2>::Purple_vertex_map Purple_vertex_map;
 
-    //insert additional vertices from the second arrangement
-    for(Vertex_iterator vit = second->vertices_begin(); vit != second->vertices_end(); vit++)
-      {
-        if(vit->data().type() == DEFAULT)
-          {
-            //legacy DEFAULT and new red blue intersections
-            pm_it = points_map.find(vit->point());
-            if(pm_it == points_map.end())
-              {
-                Vertex_handle vh = fused->insert_in_face_interior(vit->point(),uf);
-                vh->set_data(vit->data());
-                points_map.insert(std::make_pair(vit->point(),vh));
-              }
-          }
-      }
+    double t1,t2;
+    t1 = wall_time();
 
-    //memorize inserted curves as point pairs to avoid redundant insertions
-    std::set< std::pair < Point_2, Point_2> > point_pairs;
-    typename std::set< std::pair < Point_2, Point_2> >::iterator pair_it;
+    //compute the vertical decompositions of both arrangements
+    decompose_vertically(red,red_vh_x,blue,blue_vh_x);
 
-    //insert all curves from the first arrangement and memorize them
-    for(Edge_iterator ch = first->edges_begin(); ch != first->edges_end(); ch++)
-      {
-        Point_2 source = ch->source()->point();
-        Point_2 target = ch->target()->point();
+    t2 = wall_time();
+    double decomp_time = t2 - t1;
+    stats.decomp_time += decomp_time;
 
-        pm_it = points_map.find(source);
-        Vertex_handle vh_source = pm_it->second;
-        pm_it = points_map.find(target);
-        Vertex_handle vh_target = pm_it->second;
+    //both sweeps insert into one purple arrangement
+    Arrangement_2* purple = new Arrangement_2();
+    Purple_vertex_map vertices;
+    Purple_vertex_map* lazy_vertices = lazy_purple_vertices(vertices);
+    unsigned int number_of_points =
+        insert_purple_vertices(red,blue,purple,purple_vh_x,lazy_vertices);
+    Intersection_vertex_map intersections;
+    Intersection_memo<typename Arrangement_2::Point_2> memo;
 
-        X_monotone_curve_2 curve = X_monotone_curve_2(source,target);
-        fused->insert_at_vertices(curve,vh_source,vh_target);
+    //sweep from left to right
+    prepare_and_sweep(red,blue,purple,&intersections,&memo,*(red->geometry_traits()),number_of_points,stats,lazy_vertices);
 
-        if(ch->direction() == ARR_LEFT_TO_RIGHT)
-          {
-            point_pairs.insert(std::make_pair(source,target));
-          }
-        else
-          {
-            point_pairs.insert(std::make_pair(target,source));
-          }
-      }
+    //sweep the same arrangements from right to left
+    Arr_mirrored_traits_2<Traits_2> mirrored_traits(*(red->geometry_traits()));
+    prepare_and_sweep(red,blue,purple,&intersections,&memo,mirrored_traits,number_of_points,stats,lazy_vertices);
+    delete red;
+    red = 0;
+    delete blue;
+    blue = 0;
 
-    //insert additional curves from the second arrangement
-    for(Edge_iterator ch = second->edges_begin(); ch != second->edges_end(); ch++)
-      {
-        Point_2 source = ch->source()->point();
-        Point_2 target = ch->target()->point();
+    t1 = wall_time();
+    double sweep_time = t1 - t2;
+    stats.sweep_time += sweep_time;
 
-        if(ch->direction() == ARR_LEFT_TO_RIGHT)
-          {
-            pair_it = point_pairs.find(std::make_pair(source,target));
-          }
-        else
-          {
-            pair_it = point_pairs.find(std::make_pair(target,source));
-          }
+    return purple;
+  }
 
-        if(pair_it == point_pairs.end())
-          {
-            pm_it = points_map.find(source);
-            Vertex_handle vh_source = pm_it->second;
-            pm_it = points_map.find(target);
-            Vertex_handle vh_target = pm_it->second;
-            X_monotone_curve_2 curve = X_monotone_curve_2(source,target);
-            fused->insert_at_vertices(curve,vh_source,vh_target);
-          }
-      }
+// ---------------------------------------------------------------------------
+// Test whether a halfedge on the boundary of fh is the one of its edge to be
+// copied: an edge with fh on both sides is met twice, and only its halfedge
+// at the lower address counts
+//
 
-    return fused;
+template<class Halfedge_handle, class Face_handle>
+bool
+is_first_of_edge(Halfedge_handle he, Face_handle fh)
+  {
+    return he->twin()->face() != fh || &(*he) < &(*(he->twin()));
   }
 
 // ---------------------------------------------------------------------------
 // Extract a single face from an arrangement to get rid of superfluous faces;
-// also used by insert_external_endpoints()
+// done once at the end of the computation. vh_x is the vertex of point_x in
+// arr and is set to the one in the returned arrangement
 //
 
 template<class Arrangement>
 Arrangement* single_face(Arrangement* arr,
-    std::vector<typename Arrangement::Point_2>* vector = 0)
+    typename Arrangement::Vertex_handle& vh_x)
   {
     MY_CGAL_DC_PRINT("begin single_face()");
 
@@ -768,41 +961,16 @@ Arrangement* single_face(Arrangement* arr,
     typedef typename Arrangement_2::Vertex_handle Vertex_handle;
     typedef typename Arrangement_2::Face_handle Face_handle;
     typedef typename Arrangement_2::Halfedge_handle Halfedge_handle;
-    typedef typename Arrangement_2::Edge_iterator Edge_iterator;
-    typedef typename Arrangement_2::Face_iterator Face_iterator;
-    typedef typename Arrangement_2::Isolated_vertex_iterator Isolated_vertex_iterator;
     typedef typename Arrangement_2::Inner_ccb_iterator Inner_ccb_iterator;
     typedef typename Arrangement_2::Ccb_halfedge_circulator Ccb_halfedge_circulator;
-    typedef typename Arrangement_2::Point_2 Point_2;
 
     //output arrangement
     Arrangement_2* single = new Arrangement_2();
 
     //insert point_x;
-    Vertex_handle arr_vh_x = vertex_x(arr);
-    Vertex_handle vh_x = single->insert_in_face_interior(arr_vh_x->point(),single->unbounded_face());
+    Face_handle fh_x = vh_x->face();
+    vh_x = single->insert_in_face_interior(vh_x->point(),single->unbounded_face());
     vh_x->set_data(POINT_X);
-    Face_handle fh_x = arr_vh_x->face();
-
-    Vertex_handle vh_ext;
-
-    //extension for use in insert_external_endpoints
-    if(vector != 0)
-      {
-        typename std::vector<Point_2>::iterator pit;
-        for(pit = vector->begin(); pit != vector->end(); pit++)
-          {
-            vh_ext = single->insert_in_face_interior(*pit,single->unbounded_face());
-            vh_ext->set_data(EXTERNAL_ENDPOINT);
-          }
-      }
-
-    //prepare dcel
-    for(Edge_iterator eit = arr->edges_begin(); eit != arr->edges_end(); eit++)
-      {
-        eit->set_data(false);
-        eit->twin()->set_data(false);
-      }
 
     //Insert the holes in fh_x into 'single'
     for (Inner_ccb_iterator hole = fh_x->holes_begin(); hole != fh_x->holes_end(); ++hole)
@@ -812,7 +980,7 @@ Arrangement* single_face(Arrangement* arr,
         do
           {
             Halfedge_handle arr_he = curr;
-            if(arr_he->data() == false)
+            if(is_first_of_edge(arr_he,fh_x))
               {
                 Vertex_handle single_he_source;
                 if(arr_he->source()->data().has_vertex_handle())
@@ -838,9 +1006,9 @@ Arrangement* single_face(Arrangement* arr,
                     arr_he->target()->data().set_vertex_handle(single_he_target);
                   }
 
-                single->insert_at_vertices(arr_he->curve(),single_he_source,single_he_target);
-                arr_he->set_data(true);
-                arr_he->twin()->set_data(true);
+                Halfedge_handle single_he = single->insert_at_vertices(arr_he->curve(),single_he_source,single_he_target);
+                single_he->set_data(arr_he->data());
+                single_he->twin()->set_data(arr_he->data());
               }
             curr++;
           }while(curr != *hole);
@@ -854,7 +1022,7 @@ Arrangement* single_face(Arrangement* arr,
         do
           {
             Halfedge_handle arr_he = curr;
-            if(arr_he->data() == false)
+            if(is_first_of_edge(arr_he,fh_x))
               {
                 Vertex_handle single_he_source;
                 if(arr_he->source()->data().has_vertex_handle())
@@ -880,9 +1048,9 @@ Arrangement* single_face(Arrangement* arr,
                     arr_he->target()->data().set_vertex_handle(single_he_target);
                   }
 
-                single->insert_at_vertices(arr_he->curve(),single_he_source,single_he_target);
-                arr_he->set_data(true);
-                arr_he->twin()->set_data(true);
+                Halfedge_handle single_he = single->insert_at_vertices(arr_he->curve(),single_he_source,single_he_target);
+                single_he->set_data(arr_he->data());
+                single_he->twin()->set_data(arr_he->data());
               }
             curr++;
           }while(curr != fh_x->outer_ccb());
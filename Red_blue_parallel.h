@@ -0,0 +1,212 @@
+#ifndef RED_BLUE_PARALLEL_H
+#define RED_BLUE_PARALLEL_H
+
+#include "Red_blue_divide_and_conquer.h"
+#include "Work_stealing_pool.h"
+
+/*! \file
+ * parallel variant of the divide and conquer: the two halves of a level are
+ * independent until they are merged, so above a cutoff depth the red half
+ * becomes a task of a work stealing pool while the current thread computes
+ * the blue half; the merge tree and thus the result equal the sequential run
+ * by Jannis Warnat
+ */
+
+CGAL_BEGIN_NAMESPACE
+
+// ---------------------------------------------------------------------------
+// Add up the phase times of a sub computation
+//
+
+template<class Stats>
+void
+add_stats(Stats& stats, const Red_blue_stats& sub)
+  {
+    stats.decomp_time += sub.decomp_time;
+    stats.sweep_time += sub.sweep_time;
+    stats.single_face_time += sub.single_face_time;
+    stats.filtered_pairs += sub.filtered_pairs;
+    stats.intersected_pairs += sub.intersected_pairs;
+    stats.pair_table_grows += sub.pair_table_grows;
+    stats.purple_locates += sub.purple_locates;
+  }
+
+// ---------------------------------------------------------------------------
+// Copy an exact number without sharing its representation; Gmpq is reference
+// counted, other exact number types are copied by value anyway
+//
+
+template<class ET>
+ET
+fresh_exact(const ET& e)
+  {
+    return e;
+  }
+
+#ifdef CGAL_USE_GMP
+inline Gmpq
+fresh_exact(const Gmpq& e)
+  {
+    return Gmpq(e.numerator(), e.denominator());
+  }
+#endif
+
+// ---------------------------------------------------------------------------
+// Copy a point without sharing the representation of the kernel's lazy
+// number type, whose reference counts must not be touched by two threads
+//
+
+template<class Point_2>
+Point_2
+detached_point(const Point_2& p)
+  {
+    typedef typename Kernel_traits<Point_2>::Kernel::FT FT;
+    return Point_2(FT(fresh_exact(exact(p).x())), FT(fresh_exact(exact(p).y())));
+  }
+
+template<class Arrangement, class Iterator>
+Arrangement*
+red_blue_divide_and_conquer_task(
+    Iterator begin, Iterator end,
+    unsigned int first,
+    typename Arrangement::Point_2 point_x,
+    typename Arrangement::Vertex_handle& vh_x,
+    Red_blue_stats& stats,
+    Work_stealing_pool& pool,
+    unsigned int depth,
+    unsigned int cutoff_depth);
+
+// ---------------------------------------------------------------------------
+// One half of a level, run by the pool
+//
+
+template<class Arrangement, class Iterator>
+class Red_blue_task : public Work_stealing_pool::Task
+  {
+    typedef typename Arrangement::Point_2 Point_2;
+
+  public:
+
+    Iterator begin;
+    Iterator end;
+    unsigned int first;
+    Point_2 point_x;
+    Work_stealing_pool* pool;
+    unsigned int depth;
+    unsigned int cutoff_depth;
+
+    Arrangement* result;
+    typename Arrangement::Vertex_handle result_vh_x;
+    Red_blue_stats stats;
+
+    Red_blue_task(Iterator b, Iterator e, unsigned int f, Point_2 px,
+        Work_stealing_pool* p, unsigned int d, unsigned int cutoff) :
+      begin(b), end(e), first(f), point_x(detached_point(px)), pool(p), depth(d), cutoff_depth(cutoff),
+      result(0)
+      {
+      }
+
+    void
+    run()
+      {
+        result = red_blue_divide_and_conquer_task<Arrangement>(begin, end,
+            first, point_x, result_vh_x, stats, *pool, depth, cutoff_depth);
+      }
+  };
+
+// ---------------------------------------------------------------------------
+// The recursive function of the parallel variant; below the cutoff depth
+// the sequential recursion takes over. Like red_blue_recursion(), it leaves
+// the face containing point_x to be extracted and sets vh_x to its vertex
+//
+
+template<class Arrangement, class Iterator>
+Arrangement*
+red_blue_divide_and_conquer_task(
+    Iterator begin, Iterator end,
+    unsigned int first,
+    typename Arrangement::Point_2 point_x,
+    typename Arrangement::Vertex_handle& vh_x,
+    Red_blue_stats& stats,
+    Work_stealing_pool& pool,
+    unsigned int depth,
+    unsigned int cutoff_depth)
+  {
+    MY_CGAL_DC_PRINT("begin red_blue_divide_and_conquer_task");
+
+    if (depth >= cutoff_depth || pool.num_threads() < 2)
+      {
+        return red_blue_recursion<Arrangement>(begin, end, first, point_x, vh_x, stats);
+      }
+
+    Iterator iter = begin;
+
+    //no curves or one curve
+    if (iter == end || ++iter == end)
+      {
+        return red_blue_recursion<Arrangement>(begin, end, first, point_x, vh_x, stats);
+      }
+
+    //find the position to divide the set of curves, as the sequential run does
+    Iterator div_it = begin;
+    unsigned int count = 0;
+
+    for (iter = begin; iter != end; ++iter)
+      {
+        if (count % 2 == 0)
+          {
+            ++div_it;
+          }
+
+        count++;
+      }
+
+    //hand the red half to the pool and do the blue half meanwhile
+    Red_blue_task<Arrangement, Iterator> red_task(begin, div_it, first, point_x,
+        &pool, depth + 1, cutoff_depth);
+    pool.spawn(&red_task);
+
+    typename Arrangement::Vertex_handle blue_vh_x;
+    unsigned int blue_first = first + (count + 1) / 2;
+    Arrangement* blue = red_blue_divide_and_conquer_task<Arrangement>(div_it, end, blue_first, point_x, blue_vh_x, stats, pool, depth + 1, cutoff_depth);
+
+    pool.wait(&red_task);
+    Arrangement* red = red_task.result;
+    add_stats(stats, red_task.stats);
+
+    //merge red and blue
+    return red_blue_merge(red, red_task.result_vh_x, blue, blue_vh_x, vh_x, stats);
+  }
+
+// ---------------------------------------------------------------------------
+// Start the parallel single face computation on num_threads threads; the
+// levels above cutoff_depth are split into tasks. The phase times of all
+// threads are added up, so they may exceed the wall-clock time
+//
+
+template<class Arrangement, class Iterator, class Stats>
+Arrangement*
+red_blue_divide_and_conquer(
+    Iterator begin, Iterator end,
+    typename Arrangement::Point_2 point_x,
+    Stats& stats,
+    unsigned int num_threads,
+    unsigned int cutoff_depth)
+  {
+    MY_CGAL_DC_PRINT("begin parallel red_blue_divide_and_conquer");
+
+    Work_stealing_pool pool(num_threads);
+    Red_blue_stats sub;
+
+    typename Arrangement::Vertex_handle vh_x;
+    Arrangement* purple = red_blue_divide_and_conquer_task<Arrangement>(begin, end, 0, point_x, vh_x, sub, pool, 0, cutoff_depth);
+
+    purple = extract_face_x(purple, vh_x, sub);
+
+    add_stats(stats, sub);
+    return purple;
+  }
+
+CGAL_END_NAMESPACE
+
+#endif
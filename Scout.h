@@ -20,6 +20,7 @@ template<class Arrangement_, class Traits_>
 typedef    typename Sweep_line::Scout_set Scout_set;
     typedef typename Sweep_line::Scout_set_iterator Scout_set_iterator;
     typedef typename Sweep_line::Scout_set_reverse_iterator Scout_set_reverse_iterator;
+    typedef typename Traits_2::X_monotone_curve_2 X_monotone_curve_2;
     typedef typename Traits_2::Point_2 Point_2;
     typedef typename Arrangement_2::Vertex_const_handle Vertex_const_handle;
     typedef typename Arrangement_2::Vertex_handle Vertex_handle;
@@ -179,6 +180,43 @@ typedef    typename Sweep_line::Scout_set Scout_set;
         return !i_active;
       }
 
+    // the bits of scouts of color c and type t in the summaries of the scout
+    // set, active and/or idled ones; none for dummies
+    static unsigned int summary_mask(typename Traits_2::Color c, Scout_type t,
+        bool active, bool idled)
+      {
+        if((t != LOWER && t != UPPER) || (c != Traits_2::RED && c != Traits_2::BLUE))
+          {
+            return 0;
+          }
+        unsigned int shift = (c == Traits_2::RED ? 0 : 4) + (t == LOWER ? 0 : 2);
+        return (active ? (1u << shift) : 0) | (idled ? (2u << shift) : 0);
+      }
+
+    unsigned int summary_bits()
+      {
+        return summary_mask(col, s_type, i_active, !i_active);
+      }
+
+    // let the scout set know that color or activity changed
+    void refresh_scout_set()
+      {
+        if(scout_set_pos != m_scouts->end())
+          {
+            m_scouts->refresh(scout_set_pos);
+          }
+      }
+
+    // erase the scout from the scout set, e.g. while its order changes
+    void erase_from_scout_set()
+      {
+        if(scout_set_pos != m_scouts->end())
+          {
+            m_scouts->erase(scout_set_pos);
+            scout_set_pos = m_scouts->end();
+          }
+      }
+
     void set_active()
       {
         i_active = true;
@@ -195,6 +233,7 @@ typedef    typename Sweep_line::Scout_set Scout_set;
                 this->guarded_curve()->set_lower_guard(this);
               }
           }
+        refresh_scout_set();
       }
 
     void set_idled()
@@ -212,6 +251,7 @@ typedef    typename Sweep_line::Scout_set Scout_set;
           {
             this->guarded_curve()->remove_lower_guard();
           }
+        refresh_scout_set();
       }
 
     // ---------------------------------------------------------------------------
@@ -228,39 +268,11 @@ typedef    typename Sweep_line::Scout_set Scout_set;
         //insert every subcurve only once
         if(!boundary_curve()->is_in_purple())
           {
-            Point_2 left = boundary_curve()->last_curve().left();
-            Point_2 right = boundary_curve()->last_curve().right();
-
-            //the vertices are already in the purple arrangement;
-            //get these
-            Vertex_const_handle left_vh;
-            try
-              {
-                left_vh = object_cast<Vertex_const_handle> (
-                    left.purple_object());
-              }
-            catch (Bad_object_cast)
-              {
-                CGAL_assertion(false);
-              }
-
-            Vertex_const_handle right_vh;
-            try
-              {
-                right_vh = object_cast<Vertex_const_handle> (
-                    right.purple_object());
-              }
-            catch (Bad_object_cast)
-              {
-                CGAL_assertion(false);
-              }
-
-            //convert to non-const
-            Vertex_handle left_n_vh = sweep_line->get_purple()->non_const_handle(left_vh);
-            Vertex_handle right_n_vh = sweep_line->get_purple()->non_const_handle(right_vh);
+            const X_monotone_curve_2& cv = boundary_curve()->last_curve();
 
-            //insert efficiently
-            sweep_line->get_purple()->insert_at_vertices(boundary_curve()->last_curve(),left_n_vh,right_n_vh);
+            //insert at the purple vertices of its ends, which may be
+            //created only now, unless an earlier sweep did so
+            sweep_line->insert_purple_curve(cv,cv.left(),cv.right());
 
             //make sure no curve is inserted twice
             boundary_curve()->set_in_purple(true);
@@ -277,15 +289,15 @@ typedef    typename Sweep_line::Scout_set Scout_set;
       {
         if (color() == Traits_2::RED)
           {
-            sweep_line->_intersect_from_red(boundary_curve(),
-                guarded_curve());
+            sweep_line->_intersect(boundary_curve(),
+                guarded_curve(), Red_tag());
           }
         else
           {
             if(color() == Traits_2::BLUE)
               {
-                sweep_line->_intersect_from_blue(boundary_curve(),
-                    guarded_curve());
+                sweep_line->_intersect(boundary_curve(),
+                    guarded_curve(), Blue_tag());
               }
           }
       }
@@ -300,8 +312,8 @@ typedef    typename Sweep_line::Scout_set Scout_set;
           {
             if (partner()->color() == Traits_2::BLUE)
               {
-                sweep_line->_intersect_from_red(boundary_curve(),
-                    partner()->boundary_curve());
+                sweep_line->_intersect(boundary_curve(),
+                    partner()->boundary_curve(), Red_tag());
               }
           }
         else
@@ -310,8 +322,8 @@ typedef    typename Sweep_line::Scout_set Scout_set;
               {
                 if (partner()->color() == Traits_2::RED)
                   {
-                    sweep_line->_intersect_from_blue(boundary_curve(),
-                        partner()->boundary_curve());
+                    sweep_line->_intersect(boundary_curve(),
+                        partner()->boundary_curve(), Blue_tag());
                   }
               }
           }
@@ -332,27 +344,15 @@ typedef    typename Sweep_line::Scout_set Scout_set;
         //if we find no scout to idle self, it will be activated
         bool activate_self = true;
 
-        //walk down the scout set
-        Scout_set_iterator l_minus = self;
-        while(l_minus != m_scouts->begin())
+        //the highest active lower scout below of the same color, the
+        //scouts in between might be idled
+        Scout_set_iterator l_minus = m_scouts->find_prev(self,
+            summary_mask((*self)->color(), LOWER, true, false));
+        if(l_minus != m_scouts->end())
           {
-            //skip upper scouts
-            l_minus--;
-            l_minus--;
-
-            if((*l_minus)->color() == (*self)->color())
+            if((*l_minus)->guarded_curve() == (*self)->guarded_curve())
               {
-                //we must go down until we find an active one,
-                //the scouts in between might be idled
-                if((*l_minus)->is_active())
-                  {
-                    if((*l_minus)->guarded_curve() == (*self)->guarded_curve())
-                      {
-                        activate_self = false;
-                      }
-                    //either way, we can break now
-                    break;
-                  }
+                activate_self = false;
               }
           }
 
@@ -378,26 +378,15 @@ typedef    typename Sweep_line::Scout_set Scout_set;
         MY_CGAL_SL_PRINT("begin start_lower_inform_lower_above()");
         Scout_set_iterator self = scout_set_position();
 
-        //walk up the scout set
-        Scout_set_iterator l_plus = self;
-        do
+        Scout_set_iterator l_plus = m_scouts->find_next(self,
+            summary_mask((*self)->color(), LOWER, true, true));
+        if(l_plus != m_scouts->end())
           {
-            //skip upper scouts
-            l_plus++;
-            l_plus++;
-
-            if(l_plus != m_scouts->end())
+            if((*l_plus)->guarded_curve() == (*self)->guarded_curve())
               {
-                if((*l_plus)->color() == (*self)->color())
-                  {
-                    if((*l_plus)->guarded_curve() == (*self)->guarded_curve())
-                      {
-                        (*l_plus)->set_idled();
-                      }
-                    break;
-                  }
+                (*l_plus)->set_idled();
               }
-          }while(l_plus != m_scouts->end());
+          }
       }
 
     // ---------------------------------------------------------------------------
@@ -409,29 +398,17 @@ typedef    typename Sweep_line::Scout_set Scout_set;
     start_upper_inform_upper_below()
       {
         MY_CGAL_SL_PRINT("begin start_upper_inform_upper_below()");
-        Scout_set_reverse_iterator self = Scout_set_reverse_iterator(scout_set_position());
-        self--;
+        Scout_set_iterator self = scout_set_position();
 
-        //walk up the scout set
-        Scout_set_reverse_iterator u_minus = self;
-        do
+        Scout_set_iterator u_minus = m_scouts->find_prev(self,
+            summary_mask((*self)->color(), UPPER, true, true));
+        if(u_minus != m_scouts->end())
           {
-            //skip lower scouts
-            u_minus++;
-            u_minus++;
-
-            if(u_minus != m_scouts->rend())
+            if((*u_minus)->guarded_curve() == (*self)->guarded_curve())
               {
-                if((*u_minus)->color() == (*self)->color())
-                  {
-                    if((*u_minus)->guarded_curve() == (*self)->guarded_curve())
-                      {
-                        (*u_minus)->set_idled();
-                      }
-                    break;
-                  }
+                (*u_minus)->set_idled();
               }
-          }while(u_minus != m_scouts->rend());
+          }
       }
 
     // ---------------------------------------------------------------------------
@@ -445,33 +422,20 @@ typedef    typename Sweep_line::Scout_set Scout_set;
     )
       {
         MY_CGAL_SL_PRINT("begin start_upper_inform_upper_above()");
-        Scout_set_reverse_iterator self = Scout_set_reverse_iterator(scout_set_position());
-        self--;
+        Scout_set_iterator self = scout_set_position();
 
         //if we find no scout to idle self, it will be activated
         bool activate_self = true;
 
-        //walk up the scout set
-        Scout_set_reverse_iterator u_plus = self;
-        while(u_plus != m_scouts->rbegin())
+        //the lowest active upper scout above of the same color, the
+        //scouts in between might be idled
+        Scout_set_iterator u_plus = m_scouts->find_next(self,
+            summary_mask((*self)->color(), UPPER, true, false));
+        if(u_plus != m_scouts->end())
           {
-            //skip lower scouts
-            u_plus--;
-            u_plus--;
-
-            if((*u_plus)->color() == (*self)->color())
+            if((*u_plus)->guarded_curve() == (*self)->guarded_curve())
               {
-                //we must go up until we find an active one,
-                //the scouts in between might be idled
-                if((*u_plus)->is_active())
-                  {
-                    if((*u_plus)->guarded_curve() == (*self)->guarded_curve())
-                      {
-                        activate_self = false;
-                      }
-                    //either way, we can break now
-                    break;
-                  }
+                activate_self = false;
               }
           }
 
@@ -504,29 +468,18 @@ typedef    typename Sweep_line::Scout_set Scout_set;
             return;
           }
 
-        //walk up the scout set
-        Scout_set_iterator l_plus = self;
-        do
+        Scout_set_iterator l_plus = m_scouts->find_next(self,
+            summary_mask((*self)->color(), LOWER, true, true));
+        if(l_plus != m_scouts->end())
           {
-            //skip upper scouts
-            l_plus++;
-            l_plus++;
-
-            if(l_plus != m_scouts->end())
+            if ((*l_plus)->is_idled())
               {
-                if((*l_plus)->color() == (*self)->color())
-                  {
-                    if ((*l_plus)->is_idled())
-                      {
-                        (*l_plus)->set_active();
-                        (*l_plus)->set_guarded_curve((*self)->guarded_curve());
-                        (*self)->set_idled();
-                        (*l_plus)->check_individual_for_intersection();
-                      }
-                    break;
-                  }
+                (*l_plus)->set_active();
+                (*l_plus)->set_guarded_curve((*self)->guarded_curve());
+                (*self)->set_idled();
+                (*l_plus)->check_individual_for_intersection();
               }
-          }while(l_plus != m_scouts->end());
+          }
       }
 
     // ---------------------------------------------------------------------------
@@ -538,8 +491,7 @@ typedef    typename Sweep_line::Scout_set Scout_set;
     end_upper_inform_upper_below()
       {
         MY_CGAL_SL_PRINT("begin end_upper_inform_upper_below()");
-        Scout_set_reverse_iterator self = Scout_set_reverse_iterator(scout_set_position());
-        self--;
+        Scout_set_iterator self = scout_set_position();
 
         //if self is idled the "idler" will also idle the highest upper scout below
         if((*self)->is_idled())
@@ -547,28 +499,18 @@ typedef    typename Sweep_line::Scout_set Scout_set;
             return;
           }
 
-        //walk down the scout set
-        Scout_set_reverse_iterator u_minus = self;
-        do
+        Scout_set_iterator u_minus = m_scouts->find_prev(self,
+            summary_mask((*self)->color(), UPPER, true, true));
+        if(u_minus != m_scouts->end())
           {
-            u_minus++;
-            u_minus++;
-
-            if(u_minus != m_scouts->rend())
+            if ((*u_minus)->is_idled())
               {
-                if((*u_minus)->color() == (*self)->color())
-                  {
-                    if ((*u_minus)->is_idled())
-                      {
-                        (*u_minus)->set_active();
-                        (*u_minus)->set_guarded_curve((*self)->guarded_curve());
-                        (*self)->set_idled();
-                        (*u_minus)->check_individual_for_intersection();
-                      }
-                    break;
-                  }
+                (*u_minus)->set_active();
+                (*u_minus)->set_guarded_curve((*self)->guarded_curve());
+                (*self)->set_idled();
+                (*u_minus)->check_individual_for_intersection();
               }
-          }while(u_minus != m_scouts->rend());
+          }
       }
 
     const Scout_type type() const
@@ -623,6 +565,7 @@ typedef    typename Sweep_line::Scout_set Scout_set;
       {
         b_cv = b;
         col = b_cv->color();
+        refresh_scout_set();
       }
 
     void delete_upper_scout()
@@ -639,7 +582,7 @@ typedef    typename Sweep_line::Scout_set Scout_set;
           }
 
         //erase from the scout set
-        this->m_scouts->erase(scout_set_pos);
+        erase_from_scout_set();
         this->boundary_curve()->set_upper_scout(0);
       }
 
@@ -657,7 +600,7 @@ typedef    typename Sweep_line::Scout_set Scout_set;
           }
 
         //erase from the scout set
-        this->m_scouts->erase(scout_set_pos);
+        erase_from_scout_set();
         this->boundary_curve()->set_lower_scout(0);
       }
 
@@ -0,0 +1,198 @@
+#ifndef WORK_STEALING_POOL_H
+#define WORK_STEALING_POOL_H
+
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <deque>
+#include <vector>
+
+/*! \file
+ * a small fork-join thread pool with one task deque per thread: a thread
+ * takes its own tasks from the back and steals from the front of the
+ * others; a thread waiting for a task keeps running tasks meanwhile
+ * by Jannis Warnat
+ */
+
+class Work_stealing_pool
+{
+public:
+
+  // A unit of work; the pool does not take ownership
+  class Task
+  {
+    friend class Work_stealing_pool;
+
+  public:
+
+    Task() :
+      done_(false)
+    {
+    }
+
+    virtual
+    ~Task()
+    {
+    }
+
+    virtual void
+    run() = 0;
+
+  private:
+
+    bool done_;
+  };
+
+private:
+
+  std::vector<std::deque<Task*> > deques;
+  std::vector<boost::thread*> workers;
+  boost::thread_specific_ptr<unsigned int> index;
+  boost::mutex mutex;
+  boost::condition_variable changed;
+  bool shutdown;
+
+public:
+
+  /*! Constructor: the constructing thread acts as thread 0, so
+   *  num_threads - 1 additional threads are started */
+  Work_stealing_pool(unsigned int num_threads) :
+    deques(num_threads > 0 ? num_threads : 1), shutdown(false)
+  {
+    index.reset(new unsigned int(0));
+    for (unsigned int i = 1; i < deques.size(); i++)
+      {
+        workers.push_back(new boost::thread(Worker(this, i)));
+      }
+  }
+
+  /*! Destructor: all spawned tasks have to be waited for before */
+  ~Work_stealing_pool()
+  {
+      {
+        boost::mutex::scoped_lock lock(mutex);
+        shutdown = true;
+        changed.notify_all();
+      }
+    for (unsigned int i = 0; i < workers.size(); i++)
+      {
+        workers[i]->join();
+        delete workers[i];
+      }
+  }
+
+  unsigned int
+  num_threads() const
+  {
+    return deques.size();
+  }
+
+  /*! hand a task to the pool; it is put on the deque of the calling thread */
+  void
+  spawn(Task* task)
+  {
+    boost::mutex::scoped_lock lock(mutex);
+    task->done_ = false;
+    deques[own_index()].push_back(task);
+    changed.notify_all();
+  }
+
+  /*! return once the task has been run, running other tasks meanwhile */
+  void
+  wait(Task* task)
+  {
+    boost::mutex::scoped_lock lock(mutex);
+    while (!task->done_)
+      {
+        Task* next = take(own_index());
+        if (next != 0)
+          {
+            run_unlocked(next, lock);
+          }
+        else
+          {
+            changed.wait(lock);
+          }
+      }
+  }
+
+private:
+
+  // the body of the additional threads
+  struct Worker
+  {
+    Work_stealing_pool* pool;
+    unsigned int i;
+
+    Worker(Work_stealing_pool* p, unsigned int index) :
+      pool(p), i(index)
+    {
+    }
+
+    void
+    operator()()
+    {
+      pool->index.reset(new unsigned int(i));
+      boost::mutex::scoped_lock lock(pool->mutex);
+      while (!pool->shutdown)
+        {
+          Task* next = pool->take(i);
+          if (next != 0)
+            {
+              pool->run_unlocked(next, lock);
+            }
+          else
+            {
+              pool->changed.wait(lock);
+            }
+        }
+    }
+  };
+
+  // threads not known to the pool share the deque of thread 0
+  unsigned int
+  own_index()
+  {
+    unsigned int* i = index.get();
+    return (i != 0) ? *i : 0;
+  }
+
+  // newest own task first, otherwise the oldest task of another thread;
+  // called with the mutex held
+  Task*
+  take(unsigned int i)
+  {
+    if (!deques[i].empty())
+      {
+        Task* task = deques[i].back();
+        deques[i].pop_back();
+        return task;
+      }
+    for (unsigned int k = 1; k < deques.size(); k++)
+      {
+        std::deque<Task*>& victim = deques[(i + k) % deques.size()];
+        if (!victim.empty())
+          {
+            Task* task = victim.front();
+            victim.pop_front();
+            return task;
+          }
+      }
+    return 0;
+  }
+
+  // run a task with the mutex released and signal its completion
+  void
+  run_unlocked(Task* task, boost::mutex::scoped_lock& lock)
+  {
+    lock.unlock();
+    task->run();
+    lock.lock();
+    task->done_ = true;
+    changed.notify_all();
+  }
+};
+
+#endif
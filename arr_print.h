@@ -21,7 +21,7 @@ print_halfedge(typename Arrangement::Halfedge_const_handle eit)
   std::cout << "[ (" << CGAL::to_double(eit->source()->point().x()) << " "
       << CGAL::to_double(eit->source()->point().y()) << ")(" << CGAL::to_double(
       eit->target()->point().x()) << " " << CGAL::to_double(
-      eit->target()->point().y()) << ") ] << eit->data() = " << eit->data() << " eit->twin()->data() = " << eit->twin()->data() << std::endl;
+      eit->target()->point().y()) << ") ] << eit->data().segment() = " << eit->data().segment() << " eit->twin()->data().segment() = " << eit->twin()->data().segment() << std::endl;
 }
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,268 @@
+#ifndef ARR_TYPES_H
+#define ARR_TYPES_H
+
+#include <CGAL/basic.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+
+#include <CGAL/Cartesian.h>
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/Filtered_kernel.h>
+#include <CGAL/Arr_extended_dcel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+
+#include <CGAL/Arrangement_2.h>
+
+#include <CGAL/assertions_behaviour.h>
+
+#include "arr_print.h"
+
+#include <ctime>
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
+
+/*! \file
+ * kernel, traits and arrangement types used by the single face algorithm;
+ * free of any Qt dependency so that the algorithm can run headless
+ * by Jannis Warnat
+ */
+
+enum Vertex_type
+{
+  //none of below
+  DEFAULT = 0,
+
+  //vertex represents point_x
+  POINT_X = 1,
+
+  //vertex represents an original segment's endpoint
+  INTERNAL_ENDPOINT = 2,
+
+  //vertex represents an original segment's endpoint
+  //in the arrangement of the other color
+  EXTERNAL_ENDPOINT = 4
+};
+
+#define MY_CGAL_DC_PRINT(a)
+//#define MY_CGAL_DC_PRINT(a) { std::cout << a << std::endl ; }
+
+#define MY_CGAL_SL_PRINT(a)
+//#define MY_CGAL_SL_PRINT(a) { std::cout << a << std::endl ; }
+
+#define MY_CGAL_SL_DEBUG(a)
+//#define MY_CGAL_SL_DEBUG(a) {a}
+
+//create the purple vertices of the red and blue vertices when the first edge
+//is inserted at them instead of inserting all of them before the sweeps;
+//redblue_bench_lazy is built with it, to compare both
+//#define MY_CGAL_DC_LAZY_PURPLE_VERTICES
+
+
+#ifdef CGAL_USE_GMP
+
+#include <CGAL/Gmpq.h>
+
+typedef CGAL::Gmpq Exact_rational;
+
+#else
+
+#include <CGAL/MP_Float.h>
+#include <CGAL/Quotient.h>
+
+typedef CGAL::Quotient<CGAL::MP_Float> Exact_rational;
+
+#endif
+
+template<class Kernel_>
+class Kernel_vertex_data;
+
+// With an arrangement halfedge we store the index of the input segment
+// its edge is a piece of, so that the intersection of a red and a blue
+// segment can be memorized for all their pieces; both halfedges of an
+// edge store the same index
+
+class Halfedge_data
+{
+private:
+
+  unsigned int segment_;
+
+public:
+
+  // the index of a halfedge not created from an input segment
+  static const unsigned int NO_SEGMENT = ~0u;
+
+  Halfedge_data ()
+  {
+    segment_ = NO_SEGMENT;
+  }
+
+  Halfedge_data (unsigned int s)
+  {
+    segment_ = s;
+  }
+
+  void set_segment(unsigned int s)
+  {
+    segment_ = s;
+  }
+
+  unsigned int segment() const
+  {
+    return segment_;
+  }
+
+  bool has_segment() const
+  {
+    return (segment_ != NO_SEGMENT);
+  }
+};
+
+// The types of the single face algorithm over a kernel; the algorithm is
+// templated on the arrangement only, so any policy's Arrangement_2 can be
+// passed to red_blue_divide_and_conquer()
+
+template<class Kernel_>
+struct Arr_kernel_policy
+{
+  typedef Kernel_ Kernel;
+  typedef typename Kernel::FT NT;
+
+  //the traits class
+  typedef CGAL::Arr_segment_traits_2<Kernel> Traits_2;
+
+  // we use an extended dcel to store data with the vertices and the edes;
+  // we don't store meaningful date with the faces
+  typedef CGAL::Arr_extended_dcel<Traits_2, Kernel_vertex_data<Kernel>,
+      Halfedge_data, bool> Dcel;
+
+  //the arrangement
+  typedef CGAL::Arrangement_2<Traits_2, Dcel> Arrangement_2;
+};
+
+//the kernels shipped with the algorithm: exact constructions evaluated
+//lazily behind filtered predicates (the default), plain exact rational
+//arithmetic, and exact rational constructions behind interval filtered
+//predicates
+typedef CGAL::Exact_predicates_exact_constructions_kernel Epeck_kernel;
+typedef CGAL::Cartesian<Exact_rational> Rational_kernel;
+typedef CGAL::Filtered_kernel<CGAL::Simple_cartesian<Exact_rational> >
+    Filtered_rational_kernel;
+
+typedef Arr_kernel_policy<Epeck_kernel> Epeck_policy;
+typedef Arr_kernel_policy<Rational_kernel> Rational_policy;
+typedef Arr_kernel_policy<Filtered_rational_kernel> Filtered_rational_policy;
+
+//the kernel
+typedef Epeck_policy::Kernel Kernel;
+typedef Epeck_policy::NT NT;
+
+//the traits class
+typedef Epeck_policy::Traits_2 Traits_2;
+
+typedef Epeck_policy::Dcel Dcel;
+
+//the arrangement
+typedef Epeck_policy::Arrangement_2 Arrangement_2;
+
+// With an arrangement vertex we store the Vertex_type;
+// furthermore it is sometimes helpful  to store a
+// Vertex_handle to a vertex representing the same
+// geometric point in another arrangement, and the
+// index of its point among the points of a merge
+
+template<class Kernel_>
+class Kernel_vertex_data
+{
+  typedef typename Arr_kernel_policy<Kernel_>::Arrangement_2::Vertex_handle
+      Vertex_handle;
+
+private:
+
+  Vertex_type type_;
+  Vertex_handle v_handle;
+  Vertex_handle invalid_v;
+  unsigned int index_;
+
+  public:
+
+    Kernel_vertex_data (Kernel_vertex_data const & a)// Copy constructor
+    {
+      type_ = a.type();
+      v_handle = invalid_v;
+      index_ = 0;
+    }
+
+    Kernel_vertex_data & operator = (Kernel_vertex_data const & a) // Assignment operator
+    {
+      this->set_type(a.type());
+      this->unset_vertex_handle();
+      return *this;
+    }
+
+    Kernel_vertex_data ()
+    {
+      type_ = DEFAULT;
+      v_handle = invalid_v;
+      index_ = 0;
+    }
+
+  Kernel_vertex_data (Vertex_type t, Vertex_handle vh)
+  {
+    type_ = t;
+    v_handle = vh;
+    index_ = 0;
+  }
+
+  Kernel_vertex_data (Vertex_type t)
+  {
+    type_ = t;
+    v_handle = invalid_v;
+    index_ = 0;
+  }
+
+  void set_type(Vertex_type t)
+  {
+    type_ = t;
+  }
+
+  Vertex_type type() const
+  {
+    return type_;
+  }
+
+  void set_vertex_handle(Vertex_handle vh)
+  {
+    v_handle = vh;
+  }
+
+  void unset_vertex_handle()
+  {
+    v_handle = invalid_v;
+  }
+
+  bool has_vertex_handle()
+  {
+    return (v_handle != invalid_v);
+  }
+
+  Vertex_handle vertex_handle()
+  {
+    return v_handle;
+  }
+
+  void set_index(unsigned int i)
+  {
+    index_ = i;
+  }
+
+  unsigned int index() const
+  {
+    return index_;
+  }
+ };
+
+typedef Kernel_vertex_data<Kernel> Vertex_data;
+
+#endif
@@ -38,8 +38,11 @@ public:
 
   double decomp_time;
   double sweep_time;
-  double rotate_time;
-  double fuse_time;
+  double single_face_time;
+  std::size_t filtered_pairs;
+  std::size_t intersected_pairs;
+  std::size_t pair_table_grows;
+  std::size_t purple_locates;
 
   /*! Constructor */
   Qt_widget_base_tab(QWidget *parent, int tab_number);
@@ -85,9 +85,6 @@ template<class TabTraits>
           }
       }
     bbox = bbox + point_x.bbox();
-
-    //the pivot might have changed
-    pivot = compute_pivot();
   }
 
 template<class TabTraits>
@@ -163,44 +160,28 @@ template<class TabTraits>
 
     this->decomp_time = 0;
     this->sweep_time = 0;
-    this->rotate_time = 0;
-    this->fuse_time = 0;
+    this->single_face_time = 0;
+    this->filtered_pairs = 0;
+    this->intersected_pairs = 0;
+    this->pair_table_grows = 0;
+    this->purple_locates = 0;
 
-    clock_t t1, t2;
+    double t1, t2;
 
-    t1 = clock();
+    t1 = CGAL::wall_time();
 
-    //start our algorithm to find the single face containing point_x
+    //start our algorithm to find the single face containing point_x,
+    //the tab itself collects the timings
     purple = CGAL::red_blue_divide_and_conquer<Arrangement_2,
         typename std::list<X_monotone_curve_2>::iterator>(xcurves.begin(),
-        xcurves.end(), point_x, pivot);
-    t2 = clock();
-    double dc_time = double(t2 - t1);
-
-    std::cout << "red_blue_divide_and_conquer time = " << dc_time
-        / CLOCKS_PER_SEC << std::endl;
-    std::cout << "decomposition time = " << decomp_time / CLOCKS_PER_SEC
-        << std::endl;
-    std::cout << "sweep time = " << sweep_time / CLOCKS_PER_SEC << std::endl;
-    std::cout << "rotation time = " << rotate_time / CLOCKS_PER_SEC
-        << std::endl;
-    std::cout << "fuse time = " << fuse_time / CLOCKS_PER_SEC << std::endl;
-  }
-
-template<class TabTraits>
-  typename TabTraits::Point_2
-  Qt_widget_demo_tab<TabTraits>::compute_pivot()
-  {
-    double pivot_x = bbox.xmin();
-    double pivot_y = bbox.ymin();
-
-    pivot_x -= 2;
-    pivot_y -= 2;
-
-    int pivot_x_int = (int) pivot_x;
-    int pivot_y_int = (int) pivot_y;
-
-    return Point_2(pivot_x_int, pivot_y_int);
+        xcurves.end(), point_x, *this);
+    t2 = CGAL::wall_time();
+    double dc_time = t2 - t1;
+
+    std::cout << "red_blue_divide_and_conquer time = " << dc_time << std::endl;
+    std::cout << "decomposition time = " << decomp_time << std::endl;
+    std::cout << "sweep time = " << sweep_time << std::endl;
+    std::cout << "single face time = " << single_face_time << std::endl;
   }
 
 /*! draw - called everytime something changed, draw the PM and mark the
@@ -66,9 +66,6 @@ template<class TabTraits>
     bool point_x_set;
     bool x_not_isolated;
 
-    // pivot to rotate around, about the lower left corner of the bounding box
-    Point_2 pivot;
-
     // helps with the deletion of a curve
     typename std::list<X_monotone_curve_2>::iterator removable_curve;
     typename std::list<X_monotone_curve_2>::iterator prev_removable_curve;
@@ -96,9 +93,6 @@ template<class TabTraits>
     // called from draw() if we need to recompute the face containing point_x
     void compute();
 
-    //update pivot if segments or point_x change
-    Point_2 compute_pivot();
-
     /*! draw - called everytime something changed, draw the PM and mark the
      *         point location if the mode is on.
      */
@@ -0,0 +1,202 @@
+#ifndef READ_SEGMENTS_H
+#define READ_SEGMENTS_H
+
+#include <cmath>
+#include <cstddef>
+#include <istream>
+#include <list>
+#include <sstream>
+#include <string>
+
+/*! \file
+ * reader for the segment files in data/, grid/ and random/, shared by the
+ * demo and the command line tool
+ * by Jannis Warnat
+ */
+
+// ---------------------------------------------------------------------------
+// Parse the decimal digits s[begin, end) into d; false if there are none,
+// there is any other character, or the integer exceeds 2^53 and thus might
+// not be represented exactly
+//
+
+inline bool
+parse_exact_integer(const std::string& s, std::size_t begin, std::size_t end,
+    double& d)
+  {
+    const double max_exact = 9007199254740992.0; // 2^53
+
+    if (begin == end)
+      {
+        return false;
+      }
+
+    d = 0;
+    for (std::size_t i = begin; i < end; i++)
+      {
+        if (s[i] < '0' || s[i] > '9')
+          {
+            return false;
+          }
+
+        //10 * d + digit stays an exact integer up to 2^53
+        double digit = s[i] - '0';
+        if (d > (max_exact - digit) / 10)
+          {
+            return false;
+          }
+        d = 10 * d + digit;
+      }
+    return true;
+  }
+
+// ---------------------------------------------------------------------------
+// Parse a coordinate "p" or "p/q" as a double; succeeds only if the value
+// is a dyadic rational a double represents exactly, i.e. |p| <= 2^53 and q
+// a power of two up to 2^53, so that p / q is computed without rounding
+//
+
+inline bool
+parse_exact_double(const std::string& s, double& d)
+  {
+    std::size_t begin = 0;
+    bool negative = false;
+    if (!s.empty() && (s[0] == '-' || s[0] == '+'))
+      {
+        negative = (s[0] == '-');
+        begin = 1;
+      }
+
+    std::size_t slash = s.find('/', begin);
+    std::size_t end = (slash == std::string::npos) ? s.size() : slash;
+
+    double p, q = 1;
+    if (!parse_exact_integer(s, begin, end, p))
+      {
+        return false;
+      }
+    if (slash != std::string::npos)
+      {
+        int exponent;
+        if (!parse_exact_integer(s, slash + 1, s.size(), q)
+            || q == 0 || std::frexp(q, &exponent) != 0.5)
+          {
+            return false;
+          }
+      }
+
+    d = negative ? -(p / q) : p / q;
+    return true;
+  }
+
+// ---------------------------------------------------------------------------
+// Read one coordinate. A dyadic coordinate is constructed from its double,
+// so with the lazy kernel its interval is a single point, the filtered
+// predicates on it always succeed, and no exact number is built unless a
+// construction from it needs one; any other coordinate is parsed as NT and
+// clears exact_doubles
+//
+
+template<class NT>
+bool
+read_coordinate(std::istream& in, NT& x, bool& exact_doubles)
+  {
+    std::string token;
+    if (!(in >> token))
+      {
+        return false;
+      }
+
+    double d;
+    if (parse_exact_double(token, d))
+      {
+        x = NT(d);
+        return true;
+      }
+
+    exact_doubles = false;
+    std::istringstream token_in(token);
+    if (!(token_in >> x))
+      {
+        in.setstate(std::ios::failbit);
+        return false;
+      }
+    return true;
+  }
+
+// ---------------------------------------------------------------------------
+// Read a segment file: the number of segments followed by the segments as
+// "x0 y0 x1 y1"; a leading 0 announces point_x before the actual number.
+// Returns false if the stream fails before all segments are read. If
+// exact_doubles is given, it is set to whether every coordinate is a
+// double, in which case no coordinate was parsed into an exact number
+//
+
+template<class Traits>
+bool
+read_segments(std::istream& in,
+    std::list<typename Traits::X_monotone_curve_2>& xcurves,
+    typename Traits::Point_2& point_x,
+    bool& has_point_x,
+    CGAL::Bbox_2& bbox,
+    bool* exact_doubles = 0)
+  {
+    typedef typename Traits::Point_2 Point_2;
+    typedef typename Traits::X_monotone_curve_2 X_monotone_curve_2;
+    typedef typename Traits::Kernel::FT NT;
+
+    //number of segments
+    int count;
+    in >> count;
+    has_point_x = false;
+    bool all_doubles = true;
+
+    //file contains a point_x, read in
+    if (count == 0)
+      {
+        NT px0, py0;
+        read_coordinate(in, px0, all_doubles);
+        read_coordinate(in, py0, all_doubles);
+        has_point_x = true;
+        point_x = Point_2(px0, py0);
+        in >> count;
+      }
+
+    //read the segments and put them in the list
+    for (int i = 0; i < count; i++)
+      {
+        NT x0, y0, x1, y1;
+        read_coordinate(in, x0, all_doubles);
+        read_coordinate(in, y0, all_doubles);
+        read_coordinate(in, x1, all_doubles);
+        read_coordinate(in, y1, all_doubles);
+
+        if (!in)
+          {
+            return false;
+          }
+
+        Point_2 p1(x0, y0);
+        Point_2 p2(x1, y1);
+        X_monotone_curve_2 curve(p1, p2);
+
+        CGAL::Bbox_2 curve_bbox = curve.bbox();
+        if (i == 0)
+          {
+            bbox = curve_bbox;
+          }
+        else
+          {
+            bbox = bbox + curve_bbox;
+          }
+        xcurves.push_back(curve);
+      }
+
+    if (exact_doubles != 0)
+      {
+        *exact_doubles = all_doubles;
+      }
+    return true;
+  }
+
+#endif
@@ -0,0 +1,499 @@
+/*! \file
+ * benchmark runner: computes the single face containing a fixed point_x for
+ * every segment file in the given directories with each selected kernel,
+ * repeats each run, and writes the per-phase wall-clock medians and the face
+ * complexity as JSON and CSV, together with a fit against n*alpha(n)*log^2(n)
+ * by Jannis Warnat
+ */
+
+#include "arr_types.h"
+#include "Red_blue_divide_and_conquer.h"
+#include "Red_blue_parallel.h"
+#include "read_segments.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <dirent.h>
+
+// the result of all runs on one input file with one kernel
+struct Bench_row
+{
+  std::string file;
+  std::string series;
+  std::string kernel;
+  unsigned int n;
+  unsigned int face_vertices;
+  unsigned int face_edges;
+  double total;
+  double decomp;
+  double sweep;
+  double single_face;
+  double model;
+  double ratio;
+  std::size_t filtered_pairs;
+  std::size_t intersected_pairs;
+  std::size_t pair_table_grows;
+  std::size_t purple_locates;
+};
+
+// ---------------------------------------------------------------------------
+// Collect the *.txt files of a directory in lexicographic order
+//
+
+void
+list_segment_files(const std::string& dir, std::vector<std::string>& files)
+{
+  DIR* d = opendir(dir.c_str());
+  if (d == 0)
+    {
+      std::cerr << "cannot open directory " << dir << std::endl;
+      return;
+    }
+
+  std::vector<std::string> names;
+  for (dirent* entry = readdir(d); entry != 0; entry = readdir(d))
+    {
+      std::string name(entry->d_name);
+      if (name.size() > 4 && name.compare(name.size() - 4, 4, ".txt") == 0)
+        {
+          names.push_back(name);
+        }
+    }
+  closedir(d);
+
+  std::sort(names.begin(), names.end());
+  for (unsigned int i = 0; i < names.size(); i++)
+    {
+      files.push_back(dir + "/" + names[i]);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Inverse Ackermann function: the smallest k with A(k,k) >= n, where
+// A(1,1) = 3, A(2,2) = 7, A(3,3) = 61 and A(4,4) exceeds any input size
+//
+
+unsigned int
+inverse_ackermann(double n)
+{
+  if (n <= 3)
+    return 1;
+  if (n <= 7)
+    return 2;
+  if (n <= 61)
+    return 3;
+  return 4;
+}
+
+// ---------------------------------------------------------------------------
+// The expected running time n*alpha(n)*log^2(n) up to a constant
+//
+
+double
+scaling_model(unsigned int n)
+{
+  if (n < 2)
+    return 0;
+  double log_n = std::log(double(n)) / std::log(2.0);
+  return n * inverse_ackermann(n) * log_n * log_n;
+}
+
+// ---------------------------------------------------------------------------
+// Median of a set of measurements
+//
+
+double
+median(std::vector<double> values)
+{
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  unsigned int mid = values.size() / 2;
+  if (values.size() % 2 == 1)
+    return values[mid];
+  return (values[mid - 1] + values[mid]) / 2;
+}
+
+// ---------------------------------------------------------------------------
+// Test whether point_x lies on one of the segments
+//
+
+template<class X_monotone_curve_2, class Point_2>
+bool
+is_point_x_isolated(const std::list<X_monotone_curve_2>& xcurves,
+    const Point_2& point_x)
+{
+  typedef typename CGAL::Kernel_traits<Point_2>::Kernel::Segment_2 Segment_2;
+
+  for (typename std::list<X_monotone_curve_2>::const_iterator ci =
+      xcurves.begin(); ci != xcurves.end(); ci++)
+    {
+      if (Segment_2(ci->left(), ci->right()).has_on(point_x))
+        return false;
+    }
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+// One single face computation; only the lazy kernel can be split among
+// threads, the others share reference counted numbers between red and blue
+//
+
+template<class Arrangement>
+struct Single_face_runner
+{
+  template<class Iterator, class Point_2>
+  static Arrangement*
+  run(Iterator begin, Iterator end, const Point_2& point_x,
+      CGAL::Red_blue_stats& stats, unsigned int /*num_threads*/,
+      unsigned int /*cutoff_depth*/)
+  {
+    return CGAL::red_blue_divide_and_conquer<Arrangement, Iterator>(begin,
+        end, point_x, stats);
+  }
+};
+
+template<>
+struct Single_face_runner<Epeck_policy::Arrangement_2>
+{
+  typedef Epeck_policy::Arrangement_2 Arrangement;
+
+  template<class Iterator, class Point_2>
+  static Arrangement*
+  run(Iterator begin, Iterator end, const Point_2& point_x,
+      CGAL::Red_blue_stats& stats, unsigned int num_threads,
+      unsigned int cutoff_depth)
+  {
+    if (num_threads > 1)
+      {
+        return CGAL::red_blue_divide_and_conquer<Arrangement, Iterator>(begin,
+            end, point_x, stats, num_threads, cutoff_depth);
+      }
+    return CGAL::red_blue_divide_and_conquer<Arrangement, Iterator>(begin,
+        end, point_x, stats);
+  }
+};
+
+// ---------------------------------------------------------------------------
+// Run the single face computation repeatedly on one file with the kernel of
+// Policy; point_x is given as strings, as on the command line
+//
+
+template<class Policy>
+bool
+bench_file(const std::string& file, const std::string& series,
+    const std::string& kernel, const std::string& px_string,
+    const std::string& py_string, unsigned int repeats,
+    unsigned int num_threads, unsigned int cutoff_depth, Bench_row& row)
+{
+  typedef typename Policy::NT NT;
+  typedef typename Policy::Traits_2 Traits_2;
+  typedef typename Policy::Arrangement_2 Arrangement_2;
+  typedef typename Traits_2::Point_2 Point_2;
+  typedef typename Traits_2::X_monotone_curve_2 X_monotone_curve_2;
+
+  std::ifstream inputFile(file.c_str());
+  if (!inputFile.is_open())
+    {
+      std::cerr << "cannot open " << file << std::endl;
+      return false;
+    }
+
+  std::list<X_monotone_curve_2> xcurves;
+  Point_2 file_point_x;
+  bool has_point_x = false;
+  CGAL::Bbox_2 bbox;
+
+  if (!read_segments<Traits_2>(inputFile, xcurves, file_point_x, has_point_x,
+      bbox))
+    {
+      std::cerr << "cannot read " << file << std::endl;
+      return false;
+    }
+
+  //the benchmark always uses the same point_x
+  NT px0, py0;
+  std::istringstream(px_string) >> px0;
+  std::istringstream(py_string) >> py0;
+  Point_2 point_x(px0, py0);
+  if (!is_point_x_isolated(xcurves, point_x))
+    {
+      std::cerr << "skipping " << file << ", point_x lies on a segment"
+          << std::endl;
+      return false;
+    }
+
+  std::vector<double> total, decomp, sweep, single_face;
+
+  for (unsigned int r = 0; r < repeats; r++)
+    {
+      CGAL::Red_blue_stats stats;
+
+      double t1 = CGAL::wall_time();
+      Arrangement_2* purple = Single_face_runner<Arrangement_2>::run(
+          xcurves.begin(), xcurves.end(), point_x, stats, num_threads,
+          cutoff_depth);
+      double t2 = CGAL::wall_time();
+
+      total.push_back(t2 - t1);
+      decomp.push_back(stats.decomp_time);
+      sweep.push_back(stats.sweep_time);
+      single_face.push_back(stats.single_face_time);
+
+      row.face_vertices = purple->number_of_vertices();
+      row.face_edges = purple->number_of_edges();
+      row.filtered_pairs = stats.filtered_pairs;
+      row.intersected_pairs = stats.intersected_pairs;
+      row.pair_table_grows = stats.pair_table_grows;
+      row.purple_locates = stats.purple_locates;
+      delete purple;
+    }
+
+  row.file = file;
+  row.series = series;
+  row.kernel = kernel;
+  row.n = xcurves.size();
+  row.total = median(total);
+  row.decomp = median(decomp);
+  row.sweep = median(sweep);
+  row.single_face = median(single_face);
+  row.model = scaling_model(row.n);
+  row.ratio = 0;
+
+  std::cerr << file << " (" << kernel << "): n = " << row.n
+      << ", face edges = "
+      << row.face_edges << ", median time = " << row.total << std::endl;
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+// Least squares fit total = c * model per kernel and series; the ratio of
+// each row shows how far the measurement leaves the expected scaling curve
+//
+
+typedef std::pair<std::string, std::string> Kernel_series;
+
+void
+fit_series(std::vector<Bench_row>& rows, std::vector<Kernel_series>& series,
+    std::vector<double>& constants)
+{
+  for (unsigned int i = 0; i < rows.size(); i++)
+    {
+      Kernel_series ks(rows[i].kernel, rows[i].series);
+      if (std::find(series.begin(), series.end(), ks) == series.end())
+        series.push_back(ks);
+    }
+
+  for (unsigned int s = 0; s < series.size(); s++)
+    {
+      double tf = 0, ff = 0;
+      for (unsigned int i = 0; i < rows.size(); i++)
+        {
+          if (Kernel_series(rows[i].kernel, rows[i].series) != series[s])
+            continue;
+          tf += rows[i].total * rows[i].model;
+          ff += rows[i].model * rows[i].model;
+        }
+
+      double c = (ff > 0) ? tf / ff : 0;
+      constants.push_back(c);
+
+      for (unsigned int i = 0; i < rows.size(); i++)
+        {
+          if (Kernel_series(rows[i].kernel, rows[i].series) == series[s]
+              && c * rows[i].model > 0)
+            rows[i].ratio = rows[i].total / (c * rows[i].model);
+        }
+    }
+}
+
+void
+write_csv(std::ostream& out, const std::vector<Bench_row>& rows)
+{
+  out << "file,series,kernel,n,face_vertices,face_edges,total,decomposition,"
+      << "sweep,single_face,model,ratio,filtered_pairs,intersected_pairs,"
+      << "pair_table_grows,purple_locates"
+      << std::endl;
+  for (unsigned int i = 0; i < rows.size(); i++)
+    {
+      const Bench_row& r = rows[i];
+      out << r.file << "," << r.series << "," << r.kernel << "," << r.n << ","
+          << r.face_vertices
+          << "," << r.face_edges << "," << r.total << "," << r.decomp << ","
+          << r.sweep << "," << r.single_face << "," << r.model << ","
+          << r.ratio << "," << r.filtered_pairs << "," << r.intersected_pairs
+          << "," << r.pair_table_grows << "," << r.purple_locates << std::endl;
+    }
+}
+
+void
+write_json(std::ostream& out, const std::vector<Bench_row>& rows,
+    const std::vector<Kernel_series>& series,
+    const std::vector<double>& constants, const std::string& point_x,
+    unsigned int repeats, unsigned int num_threads, unsigned int cutoff_depth)
+{
+  out << "{" << std::endl;
+  out << "  \"point_x\": \"" << point_x << "\"," << std::endl;
+  out << "  \"repeats\": " << repeats << "," << std::endl;
+  out << "  \"threads\": " << num_threads << "," << std::endl;
+  out << "  \"cutoff_depth\": " << cutoff_depth << "," << std::endl;
+#ifdef MY_CGAL_DC_LAZY_PURPLE_VERTICES
+  out << "  \"purple_vertices\": \"lazy\"," << std::endl;
+#else
+  out << "  \"purple_vertices\": \"eager\"," << std::endl;
+#endif
+  out << "  \"model\": \"n*alpha(n)*log2(n)^2\"," << std::endl;
+  out << "  \"runs\": [" << std::endl;
+  for (unsigned int i = 0; i < rows.size(); i++)
+    {
+      const Bench_row& r = rows[i];
+      out << "    {\"file\": \"" << r.file << "\", \"series\": \"" << r.series
+          << "\", \"kernel\": \"" << r.kernel << "\", \"n\": " << r.n
+          << ", \"face_vertices\": " << r.face_vertices << ", \"face_edges\": "
+          << r.face_edges
+          << ", \"total\": " << r.total << ", \"decomposition\": " << r.decomp
+          << ", \"sweep\": " << r.sweep << ", \"single_face\": "
+          << r.single_face << ", \"model\": " << r.model << ", \"ratio\": "
+          << r.ratio << ", \"filtered_pairs\": " << r.filtered_pairs
+          << ", \"intersected_pairs\": " << r.intersected_pairs
+          << ", \"pair_table_grows\": " << r.pair_table_grows
+          << ", \"purple_locates\": " << r.purple_locates << "}"
+          << (i + 1 < rows.size() ? "," : "") << std::endl;
+    }
+  out << "  ]," << std::endl;
+  out << "  \"fits\": [" << std::endl;
+  for (unsigned int s = 0; s < series.size(); s++)
+    {
+      out << "    {\"kernel\": \"" << series[s].first << "\", \"series\": \""
+          << series[s].second << "\", \"c\": "
+          << constants[s] << "}" << (s + 1 < series.size() ? "," : "")
+          << std::endl;
+    }
+  out << "  ]" << std::endl;
+  out << "}" << std::endl;
+}
+
+void
+usage(const char* name)
+{
+  std::cerr << "usage: " << name
+      << " [-n <repeats>] [-x <x> <y>] [-k <kernel>] [-t <threads>]"
+      << " [-d <cutoff depth>] [-o <basename>] [<dir> ...]"
+      << std::endl;
+  std::cerr << "  defaults: -n 5 -x 1/3 1/7 -k all -t 1 -d 4"
+      << " -o redblue_bench grid random data" << std::endl;
+  std::cerr << "  -k is one of epeck, rational, filtered or all;"
+      << " -t > 1 applies to epeck only" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+  unsigned int repeats = 5;
+  unsigned int num_threads = 1;
+  unsigned int cutoff_depth = 4;
+  std::string px_string = "1/3";
+  std::string py_string = "1/7";
+  std::string kernel = "all";
+  std::string basename = "redblue_bench";
+  std::vector<std::string> dirs;
+
+  for (int i = 1; i < argc; i++)
+    {
+      std::string arg(argv[i]);
+      if (arg == "-n" && i + 1 < argc)
+        {
+          repeats = std::atoi(argv[++i]);
+        }
+      else if (arg == "-x" && i + 2 < argc)
+        {
+          px_string = argv[++i];
+          py_string = argv[++i];
+        }
+      else if (arg == "-k" && i + 1 < argc)
+        {
+          kernel = argv[++i];
+        }
+      else if (arg == "-t" && i + 1 < argc)
+        {
+          num_threads = std::atoi(argv[++i]);
+        }
+      else if (arg == "-d" && i + 1 < argc)
+        {
+          cutoff_depth = std::atoi(argv[++i]);
+        }
+      else if (arg == "-o" && i + 1 < argc)
+        {
+          basename = argv[++i];
+        }
+      else if (!arg.empty() && arg[0] == '-')
+        {
+          usage(argv[0]);
+          return 1;
+        }
+      else
+        {
+          dirs.push_back(arg);
+        }
+    }
+
+  bool all_kernels = (kernel == "all");
+  if (repeats == 0 || num_threads == 0 || (!all_kernels && kernel != "epeck"
+      && kernel != "rational" && kernel != "filtered"))
+    {
+      usage(argv[0]);
+      return 1;
+    }
+
+  if (dirs.empty())
+    {
+      dirs.push_back("grid");
+      dirs.push_back("random");
+      dirs.push_back("data");
+    }
+
+  std::vector<Bench_row> rows;
+  for (unsigned int d = 0; d < dirs.size(); d++)
+    {
+      std::vector<std::string> files;
+      list_segment_files(dirs[d], files);
+
+      for (unsigned int f = 0; f < files.size(); f++)
+        {
+          Bench_row row;
+          if ((all_kernels || kernel == "epeck")
+              && bench_file<Epeck_policy>(files[f], dirs[d], "epeck",
+                  px_string, py_string, repeats, num_threads, cutoff_depth,
+                  row))
+            rows.push_back(row);
+          if ((all_kernels || kernel == "rational")
+              && bench_file<Rational_policy>(files[f], dirs[d], "rational",
+                  px_string, py_string, repeats, num_threads, cutoff_depth,
+                  row))
+            rows.push_back(row);
+          if ((all_kernels || kernel == "filtered")
+              && bench_file<Filtered_rational_policy>(files[f], dirs[d],
+                  "filtered", px_string, py_string, repeats, num_threads,
+                  cutoff_depth, row))
+            rows.push_back(row);
+        }
+    }
+
+  std::vector<Kernel_series> series;
+  std::vector<double> constants;
+  fit_series(rows, series, constants);
+
+  std::ofstream json((basename + ".json").c_str());
+  write_json(json, rows, series, constants, px_string + " " + py_string,
+      repeats, num_threads, cutoff_depth);
+  std::ofstream csv((basename + ".csv").c_str());
+  write_csv(csv, rows);
+
+  return 0;
+}
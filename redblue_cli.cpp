@@ -0,0 +1,141 @@
+/*! \file
+ * command line front end computing the single face containing point_x
+ * without any Qt dependency; reads the same segment files as the demo
+ * by Jannis Warnat
+ */
+
+#include "arr_types.h"
+#include "Red_blue_divide_and_conquer.h"
+#include "Red_blue_parallel.h"
+#include "read_segments.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+typedef Traits_2::Point_2 Point_2;
+typedef Traits_2::X_monotone_curve_2 X_monotone_curve_2;
+
+void
+usage(const char* name)
+{
+  std::cerr << "usage: " << name
+      << " [-t <threads>] [-d <cutoff depth>] <segment file>"
+      << " [<x> <y>]" << std::endl;
+  std::cerr << "  <x> <y> override the point_x stored in the file"
+      << std::endl;
+  std::cerr << "  -t runs the divide and conquer on that many threads,"
+      << " splitting the levels above -d (default 4) into tasks" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+  unsigned int num_threads = 1;
+  unsigned int cutoff_depth = 4;
+  std::vector<std::string> args;
+
+  for (int i = 1; i < argc; i++)
+    {
+      std::string arg(argv[i]);
+      if (arg == "-t" && i + 1 < argc)
+        {
+          num_threads = std::atoi(argv[++i]);
+        }
+      else if (arg == "-d" && i + 1 < argc)
+        {
+          cutoff_depth = std::atoi(argv[++i]);
+        }
+      else
+        {
+          args.push_back(arg);
+        }
+    }
+
+  if ((args.size() != 1 && args.size() != 3) || num_threads == 0)
+    {
+      usage(argv[0]);
+      return 1;
+    }
+
+  std::ifstream inputFile(args[0].c_str());
+  if (!inputFile.is_open())
+    {
+      std::cerr << "cannot open " << args[0] << std::endl;
+      return 1;
+    }
+
+  std::list<X_monotone_curve_2> xcurves;
+  Point_2 point_x;
+  bool has_point_x = false;
+  CGAL::Bbox_2 bbox;
+  bool exact_doubles = false;
+
+  if (!read_segments<Traits_2>(inputFile, xcurves, point_x, has_point_x, bbox,
+      &exact_doubles))
+    {
+      std::cerr << "cannot read " << args[0] << std::endl;
+      return 1;
+    }
+  inputFile.close();
+
+  if (args.size() == 3)
+    {
+      NT px0, py0;
+      std::istringstream(args[1]) >> px0;
+      std::istringstream(args[2]) >> py0;
+      point_x = Point_2(px0, py0);
+      has_point_x = true;
+    }
+
+  if (!has_point_x)
+    {
+      std::cerr << "no point_x in " << args[0] << " and none given"
+          << std::endl;
+      return 1;
+    }
+
+  CGAL::Red_blue_stats stats;
+
+  double t1, t2;
+  t1 = CGAL::wall_time();
+
+  Arrangement_2* purple;
+  if (num_threads > 1)
+    {
+      purple = CGAL::red_blue_divide_and_conquer<Arrangement_2,
+          std::list<X_monotone_curve_2>::iterator>(xcurves.begin(),
+          xcurves.end(), point_x, stats, num_threads, cutoff_depth);
+    }
+  else
+    {
+      purple = CGAL::red_blue_divide_and_conquer<Arrangement_2,
+          std::list<X_monotone_curve_2>::iterator>(xcurves.begin(),
+          xcurves.end(), point_x, stats);
+    }
+
+  t2 = CGAL::wall_time();
+  double dc_time = t2 - t1;
+
+  std::cout << "segments = " << xcurves.size() << std::endl;
+  std::cout << "coordinates = " << (exact_doubles ? "doubles" : "exact")
+      << std::endl;
+  std::cout << "face vertices = " << purple->number_of_vertices()
+      << std::endl;
+  std::cout << "face edges = " << purple->number_of_edges() << std::endl;
+  std::cout << "red_blue_divide_and_conquer time = " << dc_time << std::endl;
+  std::cout << "decomposition time = " << stats.decomp_time << std::endl;
+  std::cout << "sweep time = " << stats.sweep_time << std::endl;
+  std::cout << "single face time = " << stats.single_face_time << std::endl;
+  std::cout << "curve pairs filtered = " << stats.filtered_pairs
+      << ", intersected = " << stats.intersected_pairs << std::endl;
+  std::cout << "curve pair table grows = " << stats.pair_table_grows
+      << std::endl;
+  std::cout << "purple point locations = " << stats.purple_locates
+      << std::endl;
+
+  delete purple;
+  return 0;
+}
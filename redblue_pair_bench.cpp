@@ -0,0 +1,150 @@
+/*! \file
+ * microbenchmark of the set of intersected curve pairs: the flat table the
+ * sweep uses against the Open_hash it replaced, with its old sizing and
+ * load factor policy. The queries mimic a sweep: 8 per subcurve, each a red
+ * subcurve and one of the blue subcurves near it, so many are repeated.
+ * by Jannis Warnat
+ */
+
+#include "My_Curve_pair_table.h"
+
+#include <CGAL/Sweep_line_2.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sys/time.h>
+
+struct Bench_subcurve
+{
+  double data[8];
+};
+
+typedef CGAL::Curve_pair<Bench_subcurve> Bench_curve_pair;
+typedef CGAL::Open_hash<Bench_curve_pair,
+    CGAL::Curve_pair_hasher<Bench_subcurve>,
+    CGAL::Equal_curve_pair<Bench_subcurve> > Bench_open_hash;
+
+double
+wall_time()
+{
+  timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+double
+median(std::vector<double> values)
+{
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  unsigned int mid = values.size() / 2;
+  if (values.size() % 2 == 1)
+    return values[mid];
+  return (values[mid - 1] + values[mid]) / 2;
+}
+
+void
+bench_curve_pair_sets(unsigned int n, unsigned int repeats)
+{
+  std::vector<Bench_subcurve> red(n), blue(n);
+  std::vector<std::pair<Bench_subcurve*, Bench_subcurve*> > queries;
+  std::srand(1);
+  for (unsigned int q = 0; q < 8 * n; q++)
+    {
+      unsigned int i = std::rand() % n;
+      unsigned int j = std::min(n - 1, i + std::rand() % 4);
+      queries.push_back(std::make_pair(&red[i], &blue[j]));
+    }
+
+  std::vector<double> open_hash_times, table_times;
+  std::size_t open_hash_size = 0, table_size = 0, table_grows = 0;
+  for (unsigned int r = 0; r < repeats; r++)
+    {
+      double t1 = wall_time();
+      Bench_open_hash open_hash(0);
+      open_hash.resize(4 * n);
+      for (unsigned int q = 0; q < queries.size(); q++)
+        {
+          Bench_curve_pair cv_pair(queries[q].first, queries[q].second);
+          if (!open_hash.insert(cv_pair).second)
+            continue;
+          float load_factor = static_cast<float> (open_hash.size())
+              / open_hash.bucket_count();
+          if (load_factor > 6.0f)
+            open_hash.resize(open_hash.size() * 6);
+        }
+      double t2 = wall_time();
+      open_hash_size = open_hash.size();
+
+      //sized as in the sweep, 4 pairs per subcurve
+      CGAL::Curve_pair_table<Bench_subcurve> table;
+      table.reserve(std::min<std::size_t>(8 * n, std::size_t(n) * n + 2 * n));
+      for (unsigned int q = 0; q < queries.size(); q++)
+        {
+          table.insert(queries[q].first, queries[q].second);
+        }
+      double t3 = wall_time();
+      table_size = table.size();
+      table_grows = table.grows();
+
+      open_hash_times.push_back(t2 - t1);
+      table_times.push_back(t3 - t2);
+    }
+
+  double to_ns = 1e9 / queries.size();
+  std::cout << "curve pair sets, " << n << " red and " << n
+      << " blue subcurves, " << queries.size() << " queries, "
+      << table_size << " distinct pairs" << std::endl;
+  std::cout << "  Open_hash:        " << median(open_hash_times) * to_ns
+      << " ns/query (" << open_hash_size << " pairs)" << std::endl;
+  std::cout << "  Curve_pair_table: " << median(table_times) * to_ns
+      << " ns/query (" << table_size << " pairs, " << table_grows
+      << " grows)" << std::endl;
+}
+
+void
+usage(const char* name)
+{
+  std::cerr << "usage: " << name << " [-n <repeats>] <subcurves>"
+      << std::endl;
+  std::cerr << "  defaults: -n 5" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+  unsigned int repeats = 5;
+  unsigned int subcurves = 0;
+
+  for (int i = 1; i < argc; i++)
+    {
+      std::string arg(argv[i]);
+      if (arg == "-n" && i + 1 < argc)
+        {
+          repeats = std::atoi(argv[++i]);
+        }
+      else if (!arg.empty() && arg[0] == '-')
+        {
+          usage(argv[0]);
+          return 1;
+        }
+      else
+        {
+          subcurves = std::atoi(argv[i]);
+        }
+    }
+
+  if (repeats == 0 || subcurves == 0)
+    {
+      usage(argv[0]);
+      return 1;
+    }
+
+  bench_curve_pair_sets(subcurves, repeats);
+  return 0;
+}
@@ -0,0 +1,24 @@
+/*! \file
+ * unit tests of the containers of the sweep, which need no CGAL
+ * by Jannis Warnat
+ */
+
+#include "test_check.h"
+
+#include <iostream>
+
+int
+main()
+{
+  test_scout_set();
+  test_small_vector();
+  test_sweep_arena();
+
+  if (test_failures() != 0)
+    {
+      std::cerr << test_failures() << " checks failed" << std::endl;
+      return 1;
+    }
+  std::cout << "all checks passed" << std::endl;
+  return 0;
+}
@@ -0,0 +1,59 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+#include <iostream>
+
+/*! \file
+ * the check macro of the unit tests; a failed check is reported and
+ * counted, and redblue_test exits with a failure if any check failed
+ * by Jannis Warnat
+ */
+
+inline unsigned int&
+test_failures()
+{
+  static unsigned int failures = 0;
+  return failures;
+}
+
+inline bool
+test_check(bool ok, const char* expr, const char* file, int line)
+{
+  if (!ok)
+    {
+      std::cerr << file << ":" << line << ": check failed: " << expr
+          << std::endl;
+      test_failures()++;
+    }
+  return ok;
+}
+
+#define TEST_CHECK(expr) test_check((expr), #expr, __FILE__, __LINE__)
+
+// a small linear congruential generator, so that every run of the
+// randomized tests sees the same sequence
+class Test_random
+{
+  unsigned int m_seed;
+
+public:
+
+  Test_random(unsigned int seed) :
+    m_seed(seed)
+  {
+  }
+
+  // a number in [0, n)
+  unsigned int
+  operator()(unsigned int n)
+  {
+    m_seed = m_seed * 1103515245u + 12345u;
+    return (m_seed >> 8) % n;
+  }
+};
+
+void test_scout_set();
+void test_small_vector();
+void test_sweep_arena();
+
+#endif
@@ -0,0 +1,201 @@
+/*! \file
+ * test of the interval filter of the sweep on near-degenerate segment pairs:
+ * it may leave any pair undecided, but must never call a pair disjoint that
+ * the exact do_intersect of the kernel finds intersecting
+ * by Jannis Warnat
+ */
+
+#include "test_check.h"
+#include "../My_Interval_filter.h"
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/intersections.h>
+
+#include <iostream>
+#include <vector>
+
+#include <math.h>
+
+namespace {
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef Kernel::FT FT;
+typedef Kernel::Point_2 Point_2;
+typedef Kernel::Segment_2 Segment_2;
+
+bool
+filter_disjoint(const Segment_2& s1, const Segment_2& s2)
+{
+  CGAL::Interval_segment i1, i2;
+  i1.set(s1);
+  i2.set(s2);
+  return i1.certainly_disjoint(i2);
+}
+
+// the filter is sound for the pair in both orders and both orientations
+bool
+sound(const Segment_2& s1, const Segment_2& s2)
+{
+  if (!CGAL::do_intersect(s1, s2))
+    {
+      return true;
+    }
+  return !filter_disjoint(s1, s2) && !filter_disjoint(s2, s1)
+      && !filter_disjoint(s1.opposite(), s2)
+      && !filter_disjoint(s1, s2.opposite());
+}
+
+double
+up(double d)
+{
+  return nextafter(d, 1e300);
+}
+
+double
+down(double d)
+{
+  return nextafter(d, -1e300);
+}
+
+Segment_2
+segment(double x1, double y1, double x2, double y2)
+{
+  return Segment_2(Point_2(x1, y1), Point_2(x2, y2));
+}
+
+void
+test_touching()
+{
+  //common endpoint, endpoint in the interior of the other segment
+  TEST_CHECK(sound(segment(0, 0, 1, 1), segment(1, 1, 2, 0)));
+  TEST_CHECK(sound(segment(0, 0, 2, 0), segment(1, 0, 1, 1)));
+  TEST_CHECK(sound(segment(0, 0, 3, 1), segment(1.5, 0.5, 0, 5)));
+
+  //the same at rational points, whose boxes are not points
+  Point_2 p(FT(1) / 3, FT(2) / 7);
+  TEST_CHECK(sound(Segment_2(Point_2(0, 0), p), Segment_2(p, Point_2(1, 0))));
+  Point_2 q(FT(1) / 3, FT(1) / 3);
+  TEST_CHECK(sound(Segment_2(Point_2(0, 0), Point_2(1, 1)),
+      Segment_2(q, Point_2(1, 0))));
+}
+
+void
+test_collinear()
+{
+  //overlapping, nested and touching collinear segments
+  TEST_CHECK(sound(segment(0, 0, 2, 2), segment(1, 1, 3, 3)));
+  TEST_CHECK(sound(segment(0, 0, 3, 3), segment(1, 1, 2, 2)));
+  TEST_CHECK(sound(segment(0, 0, 1, 1), segment(1, 1, 2, 2)));
+  TEST_CHECK(sound(segment(0, 0, 1, 0), segment(1, 0, 2, 0)));
+
+  Point_2 a(0, 0);
+  Point_2 b(FT(1) / 3, FT(1) / 7);
+  Point_2 c(FT(2) / 3, FT(2) / 7);
+  Point_2 d(1, FT(3) / 7);
+  TEST_CHECK(sound(Segment_2(a, c), Segment_2(b, d)));
+  TEST_CHECK(sound(Segment_2(a, b), Segment_2(b, d)));
+}
+
+void
+test_vertical()
+{
+  TEST_CHECK(sound(segment(1, 0, 1, 2), segment(0, 1, 2, 1)));
+  TEST_CHECK(sound(segment(1, 0, 1, 2), segment(1, 2, 3, 5)));
+  TEST_CHECK(sound(segment(1, 0, 1, 2), segment(0, 0, 1, 1)));
+  TEST_CHECK(sound(segment(1, 0, 1, 2), segment(1, 1, 1, 3)));
+  TEST_CHECK(sound(segment(1, 0, 1, 2), segment(1, 2, 1, 3)));
+
+  FT x = FT(1) / 3;
+  TEST_CHECK(sound(Segment_2(Point_2(x, 0), Point_2(x, 1)),
+      Segment_2(Point_2(0, 0), Point_2(1, 1))));
+}
+
+void
+test_ulp()
+{
+  //a segment through (1, 1) against segments passing 1 ulp above or below
+  //it, or ending 1 ulp short of it
+  Segment_2 diagonal = segment(0, 0, 2, 2);
+  double ys[] = { down(1), 1, up(1) };
+  for (int i = 0; i < 3; i++)
+    {
+      TEST_CHECK(sound(diagonal, segment(0, ys[i], 2, ys[i])));
+      TEST_CHECK(sound(diagonal, segment(1, ys[i], 2, 0)));
+      TEST_CHECK(sound(diagonal, segment(ys[i], ys[i], 2, 0)));
+      TEST_CHECK(sound(diagonal, segment(0, 2, ys[i], 1)));
+      TEST_CHECK(sound(diagonal, segment(ys[i], 0, ys[i], 2)));
+    }
+
+  //crossings 1 ulp apart on a long, flat segment
+  double big = 1 << 20;
+  Segment_2 flat = segment(0, 0, big, 1);
+  TEST_CHECK(sound(flat, segment(big / 2, 0.5, big / 2, up(0.5))));
+  TEST_CHECK(sound(flat, segment(big / 2, down(0.5), big / 2, 0.5)));
+  TEST_CHECK(sound(flat, segment(up(big / 2), 0, up(big / 2), 1)));
+}
+
+void
+test_decided()
+{
+  //the filter does decide clearly disjoint pairs
+  TEST_CHECK(filter_disjoint(segment(0, 0, 1, 0), segment(0, 1, 1, 1)));
+  TEST_CHECK(filter_disjoint(segment(0, 0, 1, 0), segment(2, 0, 3, 0)));
+  TEST_CHECK(filter_disjoint(segment(0, 0, 2, 2), segment(0, 1, 1, 3)));
+}
+
+void
+test_random()
+{
+  //endpoints on a small grid, moved by an ulp or replaced by thirds, so
+  //that touching, collinear and vertical pairs are frequent
+  Test_random random(5);
+  for (unsigned int n = 0; n < 20000; n++)
+    {
+      std::vector<Point_2> points;
+      for (unsigned int i = 0; i < 4; i++)
+        {
+          FT c[2];
+          for (unsigned int j = 0; j < 2; j++)
+            {
+              double d = random(4);
+              unsigned int how = random(6);
+              if (how == 0)
+                c[j] = up(d);
+              else if (how == 1)
+                c[j] = down(d);
+              else if (how == 2)
+                c[j] = FT(d) + FT(1) / 3;
+              else
+                c[j] = d;
+            }
+          points.push_back(Point_2(c[0], c[1]));
+        }
+      if (points[0] == points[1] || points[2] == points[3])
+        {
+          continue;
+        }
+      TEST_CHECK(sound(Segment_2(points[0], points[1]),
+          Segment_2(points[2], points[3])));
+    }
+}
+
+} //namespace
+
+int
+main()
+{
+  test_touching();
+  test_collinear();
+  test_vertical();
+  test_ulp();
+  test_decided();
+  test_random();
+
+  if (test_failures() != 0)
+    {
+      std::cerr << test_failures() << " checks failed" << std::endl;
+      return 1;
+    }
+  std::cout << "all checks passed" << std::endl;
+  return 0;
+}
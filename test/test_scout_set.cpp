@@ -0,0 +1,304 @@
+/*! \file
+ * randomized test of Summarized_multiset against a std::multiset, with the
+ * nearest value of given bits found by a linear scan
+ * by Jannis Warnat
+ */
+
+#include "test_check.h"
+#include "../My_Scout_set.h"
+
+#include <set>
+#include <vector>
+
+namespace {
+
+struct Item
+{
+  int key;
+  unsigned int id;
+};
+
+struct Item_compare
+{
+  int
+  operator()(const Item& a, const Item& b) const
+  {
+    return (a.key < b.key) ? -1 : ((b.key < a.key) ? 1 : 0);
+  }
+};
+
+struct Item_less
+{
+  bool
+  operator()(const Item& a, const Item& b) const
+  {
+    return a.key < b.key;
+  }
+};
+
+// the bits of an item are kept apart from it, so that they can change
+// while it is in the set
+struct Item_summary
+{
+  const std::vector<unsigned int>* bits;
+
+  Item_summary() :
+    bits(0)
+  {
+  }
+
+  Item_summary(const std::vector<unsigned int>* b) :
+    bits(b)
+  {
+  }
+
+  unsigned int
+  operator()(const Item& item) const
+  {
+    return (*bits)[item.id];
+  }
+};
+
+typedef CGAL::Summarized_multiset<Item, Item_compare, Item_summary> Set;
+typedef std::multiset<Item, Item_less> Model;
+
+Set::iterator
+set_position(Set& set, unsigned int k)
+{
+  Set::iterator it = set.begin();
+  for (unsigned int i = 0; i < k; i++)
+    {
+      ++it;
+    }
+  return it;
+}
+
+Model::iterator
+model_position(Model& model, unsigned int k)
+{
+  Model::iterator it = model.begin();
+  for (unsigned int i = 0; i < k; i++)
+    {
+      ++it;
+    }
+  return it;
+}
+
+// the index of it, size() for end()
+unsigned int
+set_index(Set& set, Set::iterator it)
+{
+  unsigned int k = 0;
+  for (Set::iterator i = set.begin(); i != it; ++i)
+    {
+      k++;
+    }
+  return k;
+}
+
+bool
+same_sequence(Set& set, const Model& model)
+{
+  if (set.size() != model.size())
+    {
+      return false;
+    }
+
+  Set::iterator it = set.begin();
+  for (Model::const_iterator m = model.begin(); m != model.end(); ++m, ++it)
+    {
+      if (it == set.end() || it->id != m->id || it->key != m->key)
+        {
+          return false;
+        }
+    }
+  if (it != set.end())
+    {
+      return false;
+    }
+
+  Set::reverse_iterator rit = set.rbegin();
+  for (Model::const_reverse_iterator m = model.rbegin(); m != model.rend();
+      ++m, ++rit)
+    {
+      if (rit == set.rend() || rit->id != m->id)
+        {
+          return false;
+        }
+    }
+  return rit == set.rend();
+}
+
+// the linear scans find_prev() and find_next() must agree with; they
+// return model.size() if there is no such value
+unsigned int
+linear_prev(const Model& model, const std::vector<unsigned int>& bits,
+    unsigned int k, unsigned int mask)
+{
+  std::vector<unsigned int> ids;
+  for (Model::const_iterator m = model.begin(); m != model.end(); ++m)
+    {
+      ids.push_back(m->id);
+    }
+  for (unsigned int i = k; i > 0; i--)
+    {
+      if (bits[ids[i - 1]] & mask)
+        {
+          return i - 1;
+        }
+    }
+  return model.size();
+}
+
+unsigned int
+linear_next(const Model& model, const std::vector<unsigned int>& bits,
+    unsigned int k, unsigned int mask)
+{
+  std::vector<unsigned int> ids;
+  for (Model::const_iterator m = model.begin(); m != model.end(); ++m)
+    {
+      ids.push_back(m->id);
+    }
+  for (unsigned int i = k + 1; i < ids.size(); i++)
+    {
+      if (bits[ids[i]] & mask)
+        {
+          return i;
+        }
+    }
+  return model.size();
+}
+
+void
+check_queries(Set& set, const Model& model,
+    const std::vector<unsigned int>& bits, Test_random& random)
+{
+  for (unsigned int q = 0; q < 4; q++)
+    {
+      unsigned int k = random(set.size() + 1);
+      unsigned int mask = random(16);
+      Set::iterator pos = set_position(set, k);
+
+      TEST_CHECK(set_index(set, set.find_prev(pos, mask))
+          == linear_prev(model, bits, k, mask));
+      if (k < set.size())
+        {
+          TEST_CHECK(set_index(set, set.find_next(pos, mask))
+              == linear_next(model, bits, k, mask));
+        }
+      else
+        {
+          TEST_CHECK(set.find_next(pos, mask) == set.end());
+        }
+    }
+}
+
+void
+run(unsigned int seed, unsigned int operations, unsigned int max_size)
+{
+  Test_random random(seed);
+  std::vector<unsigned int> bits;
+  Item_compare compare;
+  Set set(compare, Item_summary(&bits));
+  Model model;
+
+  for (unsigned int op = 0; op < operations; op++)
+    {
+      unsigned int what = random(set.size() < max_size ? 4 : 3);
+
+      if (what == 3 || set.empty())
+        {
+          //insert by comparisons; keys repeat often
+          Item item;
+          item.key = random(50);
+          item.id = bits.size();
+          bits.push_back(random(16));
+
+          Set::iterator it = set.insert(item);
+          model.insert(item);
+          TEST_CHECK(it->id == item.id);
+        }
+      else if (what == 0)
+        {
+          //insert without comparisons, with a key that fits at k
+          unsigned int k = random(set.size() + 1);
+          Set::iterator pos = set_position(set, k);
+          Model::iterator model_pos = model_position(model, k);
+
+          int lo = -10;
+          int hi = 60;
+          if (k > 0)
+            {
+              Set::iterator before = pos;
+              --before;
+              lo = before->key;
+            }
+          if (k < set.size())
+            {
+              hi = pos->key;
+            }
+
+          Item item;
+          item.key = lo + random(hi - lo + 1);
+          item.id = bits.size();
+          bits.push_back(random(16));
+
+          Set::iterator it = set.insert_before(pos, item);
+          model.insert(model_pos, item);
+          TEST_CHECK(it->id == item.id);
+          TEST_CHECK(set_index(set, it) == k);
+        }
+      else if (what == 1)
+        {
+          unsigned int k = random(set.size());
+          set.erase(set_position(set, k));
+          model.erase(model_position(model, k));
+        }
+      else
+        {
+          //change the bits of a value in the set
+          unsigned int k = random(set.size());
+          Set::iterator pos = set_position(set, k);
+          bits[pos->id] = random(16);
+          set.refresh(pos);
+        }
+
+      TEST_CHECK(set.size() == model.size());
+      TEST_CHECK(set.empty() == model.empty());
+      check_queries(set, model, bits, random);
+
+      if (op % 16 == 0)
+        {
+          TEST_CHECK(same_sequence(set, model));
+        }
+    }
+
+  TEST_CHECK(same_sequence(set, model));
+
+  //empty the set again
+  while (!set.empty())
+    {
+      unsigned int k = random(set.size());
+      set.erase(set_position(set, k));
+      model.erase(model_position(model, k));
+      TEST_CHECK(same_sequence(set, model));
+    }
+  TEST_CHECK(set.begin() == set.end());
+  TEST_CHECK(set.find_prev(set.end(), 15) == set.end());
+}
+
+} //namespace
+
+void
+test_scout_set()
+{
+  //small sets reach the empty set and the root often, larger ones deep trees
+  for (unsigned int seed = 1; seed <= 20; seed++)
+    {
+      run(seed, 400, 8);
+    }
+  for (unsigned int seed = 1; seed <= 5; seed++)
+    {
+      run(seed, 3000, 300);
+    }
+}
@@ -0,0 +1,153 @@
+/*! \file
+ * test of Small_vector against a std::vector, across the growth from the
+ * inline storage to the heap
+ * by Jannis Warnat
+ */
+
+#include "test_check.h"
+#include "../My_Small_vector.h"
+
+#include <vector>
+
+namespace {
+
+typedef CGAL::Small_vector<int, 2> Vector;
+
+bool
+same(const Vector& v, const std::vector<int>& model)
+{
+  if (v.size() != model.size() || v.empty() != model.empty())
+    {
+      return false;
+    }
+  for (std::size_t i = 0; i < model.size(); i++)
+    {
+      if (v.begin()[i] != model[i])
+        {
+          return false;
+        }
+    }
+  return v.end() - v.begin() == static_cast<std::ptrdiff_t>(model.size());
+}
+
+void
+test_growth()
+{
+  Vector v;
+  std::vector<int> model;
+  TEST_CHECK(same(v, model));
+
+  //two values inline, the third and the ninth grow the storage
+  for (int i = 0; i < 9; i++)
+    {
+      v.push_back(i);
+      model.push_back(i);
+      TEST_CHECK(same(v, model));
+      TEST_CHECK(v.front() == 0);
+    }
+
+  Vector::reverse_iterator rit = v.rbegin();
+  for (int i = 8; i >= 0; i--, ++rit)
+    {
+      TEST_CHECK(*rit == i);
+    }
+  TEST_CHECK(rit == v.rend());
+
+  v.clear();
+  model.clear();
+  TEST_CHECK(same(v, model));
+
+  //the heap storage is kept after clear()
+  v.push_back(7);
+  model.push_back(7);
+  TEST_CHECK(same(v, model));
+}
+
+void
+test_copy()
+{
+  Vector small;
+  small.push_back(1);
+
+  Vector large;
+  for (int i = 0; i < 5; i++)
+    {
+      large.push_back(10 + i);
+    }
+
+  //copies of an inline and of a heap vector
+  Vector a(small);
+  Vector b(large);
+  TEST_CHECK(a.size() == 1 && a.front() == 1);
+  TEST_CHECK(b.size() == 5 && b.begin()[4] == 14);
+  TEST_CHECK(a.begin() != small.begin() && b.begin() != large.begin());
+
+  //assignment of a heap vector to an inline one and back
+  a = large;
+  TEST_CHECK(a.size() == 5 && a.begin()[4] == 14);
+  a = small;
+  TEST_CHECK(a.size() == 1 && a.front() == 1);
+
+  //the copies are independent of their sources
+  b.push_back(15);
+  large.front() = -1;
+  TEST_CHECK(b.size() == 6 && b.front() == 10);
+
+  Vector& c = a;
+  a = c;
+  TEST_CHECK(a.size() == 1 && a.front() == 1);
+}
+
+void
+test_random()
+{
+  Test_random random(3);
+  Vector v;
+  std::vector<int> model;
+
+  for (unsigned int op = 0; op < 2000; op++)
+    {
+      unsigned int what = random(model.size() < 20 ? 4 : 3);
+      if (what == 3 || model.empty())
+        {
+          int value = random(1000);
+          unsigned int k = random(model.size() + 1);
+          Vector::iterator it = v.insert(v.begin() + k, value);
+          model.insert(model.begin() + k, value);
+          TEST_CHECK(it - v.begin() == static_cast<std::ptrdiff_t>(k));
+          TEST_CHECK(*it == value);
+        }
+      else if (what == 0)
+        {
+          unsigned int k = random(model.size());
+          Vector::iterator it = v.erase(v.begin() + k);
+          model.erase(model.begin() + k);
+          TEST_CHECK(it - v.begin() == static_cast<std::ptrdiff_t>(k));
+        }
+      else if (what == 1)
+        {
+          unsigned int k = random(model.size());
+          unsigned int l = k + random(model.size() - k + 1);
+          Vector::iterator it = v.erase(v.begin() + k, v.begin() + l);
+          model.erase(model.begin() + k, model.begin() + l);
+          TEST_CHECK(it - v.begin() == static_cast<std::ptrdiff_t>(k));
+        }
+      else
+        {
+          int value = random(1000);
+          v.push_back(value);
+          model.push_back(value);
+        }
+      TEST_CHECK(same(v, model));
+    }
+}
+
+} //namespace
+
+void
+test_small_vector()
+{
+  test_growth();
+  test_copy();
+  test_random();
+}
@@ -0,0 +1,98 @@
+/*! \file
+ * test of Sweep_arena: every object constructed is destroyed once by
+ * clear(), in the order of allocation, and the arena can be used again
+ * by Jannis Warnat
+ */
+
+#include "test_check.h"
+#include "../My_Sweep_arena.h"
+
+#include <vector>
+
+namespace {
+
+// records its destruction in a log shared by all copies
+struct Tracked
+{
+  int id;
+  std::vector<int>* log;
+
+  Tracked(int i, std::vector<int>* l) :
+    id(i), log(l)
+  {
+  }
+
+  ~Tracked()
+  {
+    log->push_back(id);
+  }
+};
+
+void
+fill(CGAL::Sweep_arena<Tracked>& arena, std::vector<Tracked*>& objects,
+    std::vector<int>& log, int first, int n)
+{
+  for (int i = first; i < first + n; i++)
+    {
+      Tracked* t = new (arena.allocate()) Tracked(i, &log);
+      objects.push_back(t);
+    }
+}
+
+// the objects are distinct, still hold their values, and clear() destroys
+// each of them once in the order of allocation
+void
+check_round(CGAL::Sweep_arena<Tracked>& arena, int first, int n)
+{
+  std::vector<int> log;
+  std::vector<Tracked*> objects;
+  fill(arena, objects, log, first, n);
+
+  for (int i = 0; i < n; i++)
+    {
+      TEST_CHECK(objects[i]->id == first + i);
+      for (int j = 0; j < i; j++)
+        {
+          TEST_CHECK(objects[i] != objects[j]);
+        }
+    }
+  TEST_CHECK(log.empty());
+
+  arena.clear();
+  TEST_CHECK(log.size() == static_cast<std::size_t>(n));
+  for (std::size_t i = 0; i < log.size(); i++)
+    {
+      TEST_CHECK(log[i] == first + static_cast<int>(i));
+    }
+}
+
+} //namespace
+
+void
+test_sweep_arena()
+{
+  //blocks of three: empty, partial, exactly full and several blocks
+  CGAL::Sweep_arena<Tracked> arena(3);
+  check_round(arena, 0, 0);
+  check_round(arena, 0, 2);
+  check_round(arena, 10, 3);
+  check_round(arena, 20, 10);
+
+  //clear() twice in a row destroys nothing more
+  std::vector<int> log;
+  std::vector<Tracked*> objects;
+  fill(arena, objects, log, 0, 4);
+  arena.clear();
+  arena.clear();
+  TEST_CHECK(log.size() == 4);
+
+  //construct() copies, the destructor of the arena clears it
+  log.clear();
+  {
+    CGAL::Sweep_arena<Tracked> other;
+    Tracked* t = other.construct(Tracked(5, &log));
+    TEST_CHECK(t->id == 5);
+    log.clear();
+  }
+  TEST_CHECK(log.size() == 1 && log[0] == 5);
+}